@@ -345,6 +345,8 @@ static int do_kvm_destroy_vcpu(CPUState *cpu)
     if (ret < 0) {
         goto err;
     }
+    g_free(cpu->mmio_cache);
+    cpu->mmio_cache = NULL;
 
     if (cpu->kvm_dirty_gfns) {
         ret = munmap(cpu->kvm_dirty_gfns, s->kvm_dirty_ring_bytes);
@@ -431,6 +433,8 @@ int kvm_init_vcpu(CPUState *cpu, Error **errp)
             (void *)cpu->kvm_run + s->coalesced_mmio * PAGE_SIZE;
     }
 
+    cpu->mmio_cache = g_new0(MMIODispatchCache, 1);
+
     if (s->kvm_dirty_ring_size) {
         /* Use MAP_SHARED to share pages with the kernel */
         cpu->kvm_dirty_gfns = mmap(NULL, s->kvm_dirty_ring_bytes,
@@ -2986,11 +2990,11 @@ int kvm_cpu_exec(CPUState *cpu)
         case KVM_EXIT_MMIO:
             DPRINTF("handle_mmio\n");
             /* Called outside BQL */
-            address_space_rw(&address_space_memory,
-                             run->mmio.phys_addr, attrs,
-                             run->mmio.data,
-                             run->mmio.len,
-                             run->mmio.is_write);
+            address_space_mmio_rw(&address_space_memory, cpu->mmio_cache,
+                                  run->mmio.phys_addr, attrs,
+                                  run->mmio.data,
+                                  run->mmio.len,
+                                  run->mmio.is_write);
             ret = 0;
             break;
         case KVM_EXIT_IRQ_WINDOW_OPEN:
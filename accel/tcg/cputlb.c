@@ -233,6 +233,7 @@ static void tlb_mmu_flush_locked(CPUTLBDesc *desc, CPUTLBDescFast *fast)
     desc->n_used_entries = 0;
     desc->large_page_addr = -1;
     desc->large_page_mask = -1;
+    desc->lp_fill_addr = -1;
     desc->vindex = 0;
     memset(fast->table, -1, sizeof_tlb(fast));
     memset(desc->vtable, -1, sizeof(desc->vtable));
@@ -1137,6 +1138,15 @@ void tlb_set_page_full(CPUState *cpu, int mmu_idx,
     } else {
         sz = (hwaddr)1 << full->lg_page_size;
         tlb_add_large_page(env, mmu_idx, vaddr, sz);
+        /*
+         * Remember the translation for the whole large page.  Pages that
+         * must be written through tlb_fill every time are not cached.
+         */
+        if (tcg_large_page_fill && !(full->prot & PAGE_WRITE_INV)) {
+            desc->lp_fill_addr = vaddr & ~(target_ulong)(sz - 1);
+            desc->lp_fill_full = *full;
+            desc->lp_fill_full.phys_addr &= ~(sz - 1);
+        }
     }
     vaddr_page = vaddr & TARGET_PAGE_MASK;
     paddr_page = full->phys_addr & TARGET_PAGE_MASK;
@@ -1307,6 +1317,36 @@ void tlb_set_page(CPUState *cpu, target_ulong vaddr,
                             prot, mmu_idx, size);
 }
 
+/*
+ * Try to fill the TLB for ADDR from the cached large page translation,
+ * avoiding a walk of the guest page tables.  This is only valid when the
+ * cached protection already permits ACCESS_TYPE: otherwise the target
+ * must see the access, e.g. to raise a fault or to update dirty bits.
+ * Any flush of a page within the large page flushes the whole mmu_idx,
+ * which also invalidates the cached translation.
+ */
+static bool tlb_fill_large_page(CPUState *cpu, target_ulong addr,
+                                MMUAccessType access_type, int mmu_idx)
+{
+    CPUTLBDesc *desc = &env_tlb(cpu->env_ptr)->d[mmu_idx];
+    CPUTLBEntryFull full;
+    target_ulong lp_mask;
+
+    if (desc->lp_fill_addr == (target_ulong)-1) {
+        return false;
+    }
+    lp_mask = ~(target_ulong)0 << desc->lp_fill_full.lg_page_size;
+    if ((addr & lp_mask) != desc->lp_fill_addr ||
+        !(desc->lp_fill_full.prot & (1 << access_type))) {
+        return false;
+    }
+
+    full = desc->lp_fill_full;
+    full.phys_addr |= addr & ~lp_mask & TARGET_PAGE_MASK;
+    tlb_set_page_full(cpu, mmu_idx, addr & TARGET_PAGE_MASK, &full);
+    return true;
+}
+
 /*
  * Note: tlb_fill() can trigger a resize of the TLB. This means that all of the
  * caller's prior references to the TLB table (e.g. CPUTLBEntry pointers) must
@@ -1317,6 +1357,10 @@ static void tlb_fill(CPUState *cpu, target_ulong addr, int size,
 {
     bool ok;
 
+    if (tlb_fill_large_page(cpu, addr, access_type, mmu_idx)) {
+        return;
+    }
+
     /*
      * This is not a probe, so only valid return is success; failure
      * should result in exception + longjmp to the cpu loop.
@@ -1552,7 +1596,8 @@ static int probe_access_internal(CPUArchState *env, target_ulong addr,
         if (!victim_tlb_hit(env, mmu_idx, index, elt_ofs, page_addr)) {
             CPUState *cs = env_cpu(env);
 
-            if (!cs->cc->tcg_ops->tlb_fill(cs, addr, fault_size, access_type,
+            if (!tlb_fill_large_page(cs, addr, access_type, mmu_idx) &&
+                !cs->cc->tcg_ops->tlb_fill(cs, addr, fault_size, access_type,
                                            mmu_idx, nonfault, retaddr)) {
                 /* Non-faulting page table read failed.  */
                 *phost = NULL;
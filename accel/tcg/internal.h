@@ -46,7 +46,7 @@ TranslationBlock *tb_gen_code(CPUState *cpu, target_ulong pc,
                               target_ulong cs_base, uint32_t flags,
                               int cflags);
 void page_init(void);
-void tb_htable_init(void);
+void tb_htable_init(bool partitioned);
 void tb_reset_jump(TranslationBlock *tb, int n);
 TranslationBlock *tb_link_page(TranslationBlock *tb, tb_page_addr_t phys_pc,
                                tb_page_addr_t phys_page2);
@@ -64,6 +64,7 @@ static inline target_ulong log_pc(CPUState *cpu, const TranslationBlock *tb)
     }
 }
 
+extern bool tcg_large_page_fill;
 extern int64_t max_delay;
 extern int64_t max_advance;
 
@@ -56,10 +56,14 @@ static bool tb_cmp(const void *ap, const void *bp)
             tb_page_addr1(a) == tb_page_addr1(b));
 }
 
-void tb_htable_init(void)
+void tb_htable_init(bool partitioned)
 {
     unsigned int mode = QHT_MODE_AUTO_RESIZE;
 
+    if (partitioned) {
+        mode |= QHT_MODE_PARTITIONED;
+    }
+
     qht_init(&tb_ctx.htable, tb_cmp, CODE_GEN_HTABLE_SIZE, mode);
 }
 
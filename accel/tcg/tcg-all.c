@@ -42,6 +42,8 @@ struct TCGState {
     AccelState parent_obj;
 
     bool mttcg_enabled;
+    bool large_page_fill;
+    bool partitioned_htable;
     int splitwx_enabled;
     unsigned long tb_size;
 };
@@ -109,6 +111,7 @@ static void tcg_accel_instance_init(Object *obj)
 }
 
 bool mttcg_enabled;
+bool tcg_large_page_fill;
 
 static int tcg_init_machine(MachineState *ms)
 {
@@ -121,9 +124,10 @@ static int tcg_init_machine(MachineState *ms)
 
     tcg_allowed = true;
     mttcg_enabled = s->mttcg_enabled;
+    tcg_large_page_fill = s->large_page_fill;
 
     page_init();
-    tb_htable_init();
+    tb_htable_init(s->partitioned_htable);
     tcg_init(s->tb_size * MiB, s->splitwx_enabled, max_cpus);
 
 #if defined(CONFIG_SOFTMMU)
@@ -208,6 +212,30 @@ static void tcg_set_splitwx(Object *obj, bool value, Error **errp)
     s->splitwx_enabled = value;
 }
 
+static bool tcg_get_large_page_fill(Object *obj, Error **errp)
+{
+    TCGState *s = TCG_STATE(obj);
+    return s->large_page_fill;
+}
+
+static void tcg_set_large_page_fill(Object *obj, bool value, Error **errp)
+{
+    TCGState *s = TCG_STATE(obj);
+    s->large_page_fill = value;
+}
+
+static bool tcg_get_partitioned_htable(Object *obj, Error **errp)
+{
+    TCGState *s = TCG_STATE(obj);
+    return s->partitioned_htable;
+}
+
+static void tcg_set_partitioned_htable(Object *obj, bool value, Error **errp)
+{
+    TCGState *s = TCG_STATE(obj);
+    s->partitioned_htable = value;
+}
+
 static int tcg_gdbstub_supported_sstep_flags(void)
 {
     /*
@@ -245,6 +273,17 @@ static void tcg_accel_class_init(ObjectClass *oc, void *data)
         tcg_get_splitwx, tcg_set_splitwx);
     object_class_property_set_description(oc, "split-wx",
         "Map jit pages into separate RW and RX regions");
+
+    object_class_property_add_bool(oc, "large-page-fill",
+        tcg_get_large_page_fill, tcg_set_large_page_fill);
+    object_class_property_set_description(oc, "large-page-fill",
+        "Refill the softmmu tlb from cached large page translations");
+
+    object_class_property_add_bool(oc, "tb-htable-partitioned",
+        tcg_get_partitioned_htable, tcg_set_partitioned_htable);
+    object_class_property_set_description(oc, "tb-htable-partitioned",
+        "Split the translation block hash table into independently "
+        "resized parts");
 }
 
 static const TypeInfo tcg_accel_type = {
@@ -23,6 +23,7 @@
 #include "tcg/tcg.h"
 #include "qemu/bitops.h"
 #include "qemu/rcu.h"
+#include "qemu/seqlock.h"
 #include "exec/cpu_ldst.h"
 #include "exec/translate-all.h"
 #include "exec/helper-proto.h"
@@ -144,6 +145,18 @@ typedef struct PageFlagsNode {
 
 static IntervalTreeRoot pageflags_root;
 
+/*
+ * Lookups without the mmap_lock may miss nodes that a concurrent update
+ * is moving around (see util/interval-tree.c re lockless lookups).  All
+ * updates are bracketed by pageflags_seq, so a lockless lookup that did
+ * not overlap an update is authoritative, negative or not, and only the
+ * lookups that raced with one have to be repeated.
+ */
+static QemuSeqLock pageflags_seq;
+
+/* Lockless attempts before a contended lookup falls back to the lock. */
+#define PAGEFLAGS_LOCKLESS_TRIES 4
+
 static PageFlagsNode *pageflags_find(target_ulong start, target_long last)
 {
     IntervalTreeNode *n;
@@ -161,6 +174,48 @@ static PageFlagsNode *pageflags_next(PageFlagsNode *p, target_ulong start,
     return n ? container_of(n, PageFlagsNode, itree) : NULL;
 }
 
+/*
+ * Copy the first node intersecting [start,last] to @ret, or return false
+ * if there is none.  Does not require the mmap_lock.
+ */
+static bool pageflags_lookup(target_ulong start, target_ulong last,
+                             PageFlagsNode *ret)
+{
+    PageFlagsNode *p;
+
+    if (!have_mmap_lock()) {
+        RCU_READ_LOCK_GUARD();
+
+        for (int i = 0; i < PAGEFLAGS_LOCKLESS_TRIES; i++) {
+            unsigned seq = seqlock_read_begin(&pageflags_seq);
+
+            p = pageflags_find(start, last);
+            if (p) {
+                ret->itree.start = p->itree.start;
+                ret->itree.last = p->itree.last;
+                ret->flags = p->flags;
+            }
+            if (!seqlock_read_retry(&pageflags_seq, seq)) {
+                return p != NULL;
+            }
+        }
+
+        mmap_lock();
+        p = pageflags_find(start, last);
+        if (p) {
+            *ret = *p;
+        }
+        mmap_unlock();
+        return p != NULL;
+    }
+
+    p = pageflags_find(start, last);
+    if (p) {
+        *ret = *p;
+    }
+    return p != NULL;
+}
+
 int walk_memory_regions(void *priv, walk_memory_regions_fn fn)
 {
     IntervalTreeNode *n;
@@ -207,24 +262,9 @@ void page_dump(FILE *f)
 
 int page_get_flags(target_ulong address)
 {
-    PageFlagsNode *p = pageflags_find(address, address);
-
-    /*
-     * See util/interval-tree.c re lockless lookups: no false positives but
-     * there are false negatives.  If we find nothing, retry with the mmap
-     * lock acquired.
-     */
-    if (p) {
-        return p->flags;
-    }
-    if (have_mmap_lock()) {
-        return 0;
-    }
+    PageFlagsNode p;
 
-    mmap_lock();
-    p = pageflags_find(address, address);
-    mmap_unlock();
-    return p ? p->flags : 0;
+    return pageflags_lookup(address, address, &p) ? p.flags : 0;
 }
 
 /* A subroutine of page_set_flags: insert a new node for [start,last]. */
@@ -507,6 +547,7 @@ void page_set_flags(target_ulong start, target_ulong last, int flags)
         }
     }
 
+    seqlock_write_begin(&pageflags_seq);
     if (!flags || reset) {
         page_reset_target_data(start, last);
         inval_tb |= pageflags_unset(start, last);
@@ -515,6 +556,7 @@ void page_set_flags(target_ulong start, target_ulong last, int flags)
         inval_tb |= pageflags_set_clear(start, last, flags,
                                         ~(reset ? 0 : PAGE_STICKY));
     }
+    seqlock_write_end(&pageflags_seq);
     if (inval_tb) {
         tb_invalidate_phys_range(start, last);
     }
@@ -523,7 +565,6 @@ void page_set_flags(target_ulong start, target_ulong last, int flags)
 int page_check_range(target_ulong start, target_ulong len, int flags)
 {
     target_ulong last;
-    int locked;  /* tri-state: =0: unlocked, +1: global, -1: local */
     int ret;
 
     if (len == 0) {
@@ -535,38 +576,26 @@ int page_check_range(target_ulong start, target_ulong len, int flags)
         return -1; /* wrap around */
     }
 
-    locked = have_mmap_lock();
     while (true) {
-        PageFlagsNode *p = pageflags_find(start, last);
+        PageFlagsNode p;
         int missing;
 
-        if (!p) {
-            if (!locked) {
-                /*
-                 * Lockless lookups have false negatives.
-                 * Retry with the lock held.
-                 */
-                mmap_lock();
-                locked = -1;
-                p = pageflags_find(start, last);
-            }
-            if (!p) {
-                ret = -1; /* entire region invalid */
-                break;
-            }
+        if (!pageflags_lookup(start, last, &p)) {
+            ret = -1; /* entire region invalid */
+            break;
         }
-        if (start < p->itree.start) {
+        if (start < p.itree.start) {
             ret = -1; /* initial bytes invalid */
             break;
         }
 
-        missing = flags & ~p->flags;
+        missing = flags & ~p.flags;
         if (missing & PAGE_READ) {
             ret = -1; /* page not readable */
             break;
         }
         if (missing & PAGE_WRITE) {
-            if (!(p->flags & PAGE_WRITE_ORG)) {
+            if (!(p.flags & PAGE_WRITE_ORG)) {
                 ret = -1; /* page not writable */
                 break;
             }
@@ -584,16 +613,11 @@ int page_check_range(target_ulong start, target_ulong len, int flags)
             continue;
         }
 
-        if (last <= p->itree.last) {
+        if (last <= p.itree.last) {
             ret = 0; /* ok */
             break;
         }
-        start = p->itree.last + 1;
-    }
-
-    /* Release the lock if acquired locally. */
-    if (locked < 0) {
-        mmap_unlock();
+        start = p.itree.last + 1;
     }
     return ret;
 }
@@ -629,7 +653,9 @@ void page_protect(tb_page_addr_t address)
     }
 
     if (prot & PAGE_WRITE) {
+        seqlock_write_begin(&pageflags_seq);
         pageflags_set_clear(start, last, 0, PAGE_WRITE);
+        seqlock_write_end(&pageflags_seq);
         mprotect(g2h_untagged(start), qemu_host_page_size,
                  prot & (PAGE_READ | PAGE_EXEC) ? PROT_READ : PROT_NONE);
     }
@@ -683,7 +709,9 @@ int page_unprotect(target_ulong address, uintptr_t pc)
             start = address & TARGET_PAGE_MASK;
             len = TARGET_PAGE_SIZE;
             prot = p->flags | PAGE_WRITE;
+            seqlock_write_begin(&pageflags_seq);
             pageflags_set_clear(start, start + len - 1, PAGE_WRITE, 0);
+            seqlock_write_end(&pageflags_seq);
             current_tb_invalidated = tb_invalidate_phys_page_unwind(start, pc);
         } else {
             start = address & qemu_host_page_mask;
@@ -698,8 +726,10 @@ int page_unprotect(target_ulong address, uintptr_t pc)
                     prot |= p->flags;
                     if (p->flags & PAGE_WRITE_ORG) {
                         prot |= PAGE_WRITE;
+                        seqlock_write_begin(&pageflags_seq);
                         pageflags_set_clear(addr, addr + TARGET_PAGE_SIZE - 1,
                                             PAGE_WRITE, 0);
+                        seqlock_write_end(&pageflags_seq);
                     }
                 }
                 /*
@@ -11,6 +11,7 @@
 #include "qemu/osdep.h"
 #include <liburing.h>
 #include "block/aio.h"
+#include "block/aio-wait.h"
 #include "qemu/queue.h"
 #include "block/block.h"
 #include "block/raw-aio.h"
@@ -29,6 +30,13 @@ typedef struct LuringAIOCB {
     bool is_read;
     QSIMPLEQ_ENTRY(LuringAIOCB) next;
 
+    /*
+     * Requests submitted to the AioContext's io_uring, see
+     * luring_use_aio_context_ring(), complete through cqe_handler.
+     */
+    LuringState *s;
+    CqeHandler cqe_handler;
+
     /*
      * Buffered reads may require resubmission, see
      * luring_resubmit_short_read().
@@ -57,6 +65,29 @@ typedef struct LuringState {
     QEMUBH *completion_bh;
 } LuringState;
 
+static void luring_prep_sqe(struct io_uring_sqe *sqe, void *opaque)
+{
+    LuringAIOCB *luringcb = opaque;
+
+    *sqe = luringcb->sqeq;
+
+    /* sqeq's user_data is for the private ring, aio_add_sqe() sets its own */
+    io_uring_sqe_set_data(sqe, NULL);
+}
+
+/*
+ * When the AioContext monitors file descriptors with io_uring, requests go
+ * straight to that ring: the event loop submits them and reaps their
+ * completions with the same io_uring_enter(2) call it uses to wait for
+ * events.  That ring may only be used from the AioContext's home thread, so
+ * requests submitted from elsewhere still use the ring in LuringState.
+ */
+static bool luring_use_aio_context_ring(LuringState *s)
+{
+    return aio_has_io_uring(s->aio_context) &&
+           in_aio_context_home_thread(s->aio_context);
+}
+
 /**
  * luring_resubmit:
  *
@@ -65,6 +96,17 @@ typedef struct LuringState {
  */
 static void luring_resubmit(LuringState *s, LuringAIOCB *luringcb)
 {
+    if (luringcb->cqe_handler.cb) {
+        if (aio_has_io_uring(s->aio_context)) {
+            aio_add_sqe(s->aio_context, luring_prep_sqe, luringcb,
+                        &luringcb->cqe_handler);
+            return;
+        }
+
+        /* The AioContext stopped using io_uring, see luring_cqe_handler() */
+        luringcb->cqe_handler.cb = NULL;
+    }
+
     QSIMPLEQ_INSERT_TAIL(&s->io_q.submit_queue, luringcb, next);
     s->io_q.in_queue++;
 }
@@ -105,6 +147,107 @@ static void luring_resubmit_short_read(LuringState *s, LuringAIOCB *luringcb,
     luring_resubmit(s, luringcb);
 }
 
+/**
+ * luring_complete:
+ * @s: AIO state
+ * @luringcb: the completed request
+ * @ret: result of the cqe
+ *
+ * Resubmits the request if it needs to be retried or continued, otherwise
+ * stores its result and wakes up its coroutine.
+ */
+static void luring_complete(LuringState *s, LuringAIOCB *luringcb, int ret)
+{
+    int total_bytes;
+
+    trace_luring_process_completion(s, luringcb, ret);
+
+    /* total_read is non-zero only for resubmitted read requests */
+    total_bytes = ret + luringcb->total_read;
+
+    if (ret < 0) {
+        /*
+         * Only writev/readv/fsync requests on regular files or host block
+         * devices are submitted. Therefore -EAGAIN is not expected but it's
+         * known to happen sometimes with Linux SCSI. Submit again and hope
+         * the request completes successfully.
+         *
+         * For more information, see:
+         * https://lore.kernel.org/io-uring/20210727165811.284510-3-axboe@kernel.dk/T/#u
+         *
+         * If the code is changed to submit other types of requests in the
+         * future, then this workaround may need to be extended to deal with
+         * genuine -EAGAIN results that should not be resubmitted
+         * immediately.
+         */
+        if (ret == -EINTR || ret == -EAGAIN) {
+            luring_resubmit(s, luringcb);
+            return;
+        }
+    } else if (!luringcb->qiov) {
+        goto end;
+    } else if (total_bytes == luringcb->qiov->size) {
+        ret = 0;
+    /* Only read/write */
+    } else {
+        /* Short Read/Write */
+        if (luringcb->is_read) {
+            if (ret > 0) {
+                luring_resubmit_short_read(s, luringcb, ret);
+                return;
+            } else {
+                /* Pad with zeroes */
+                qemu_iovec_memset(luringcb->qiov, total_bytes, 0,
+                                  luringcb->qiov->size - total_bytes);
+                ret = 0;
+            }
+        } else {
+            ret = -ENOSPC;
+        }
+    }
+end:
+    luringcb->ret = ret;
+    qemu_iovec_destroy(&luringcb->resubmit_qiov);
+
+    /*
+     * If the coroutine is already entered it must be in ioq_submit()
+     * and will notice luringcb->ret has been filled in when it
+     * eventually runs later. Coroutines cannot be entered recursively
+     * so avoid doing that!
+     */
+    if (!qemu_coroutine_entered(luringcb->co)) {
+        aio_co_wake(luringcb->co);
+    }
+}
+
+static int ioq_submit(LuringState *s);
+
+/* Completion of a request submitted to the AioContext's io_uring */
+static void luring_cqe_handler(CqeHandler *cqe_handler)
+{
+    LuringAIOCB *luringcb = container_of(cqe_handler, LuringAIOCB,
+                                         cqe_handler);
+    LuringState *s = luringcb->s;
+    int ret = cqe_handler->cqe.res;
+
+    /*
+     * The AioContext cancelled the request because it stopped using
+     * io_uring, see aio_add_sqe().  The request itself did not fail, so
+     * start it again on the private ring instead of failing it.
+     */
+    if (ret == -ECANCELED && !aio_has_io_uring(s->aio_context)) {
+        trace_luring_resubmit_cancelled(s, luringcb);
+        luring_resubmit(s, luringcb);
+    } else {
+        luring_complete(s, luringcb, ret);
+    }
+
+    /* luring_resubmit() may have fallen back to the private ring */
+    if (s->io_q.in_queue) {
+        ioq_submit(s);
+    }
+}
+
 /**
  * luring_process_completions:
  * @s: AIO state
@@ -121,7 +264,6 @@ static void luring_resubmit_short_read(LuringState *s, LuringAIOCB *luringcb,
 static void luring_process_completions(LuringState *s)
 {
     struct io_uring_cqe *cqes;
-    int total_bytes;
     /*
      * Request completion callbacks can run the nested event loop.
      * Schedule ourselves so the nested event loop will "see" remaining
@@ -154,64 +296,7 @@ static void luring_process_completions(LuringState *s)
 
         /* Change counters one-by-one because we can be nested. */
         s->io_q.in_flight--;
-        trace_luring_process_completion(s, luringcb, ret);
-
-        /* total_read is non-zero only for resubmitted read requests */
-        total_bytes = ret + luringcb->total_read;
-
-        if (ret < 0) {
-            /*
-             * Only writev/readv/fsync requests on regular files or host block
-             * devices are submitted. Therefore -EAGAIN is not expected but it's
-             * known to happen sometimes with Linux SCSI. Submit again and hope
-             * the request completes successfully.
-             *
-             * For more information, see:
-             * https://lore.kernel.org/io-uring/20210727165811.284510-3-axboe@kernel.dk/T/#u
-             *
-             * If the code is changed to submit other types of requests in the
-             * future, then this workaround may need to be extended to deal with
-             * genuine -EAGAIN results that should not be resubmitted
-             * immediately.
-             */
-            if (ret == -EINTR || ret == -EAGAIN) {
-                luring_resubmit(s, luringcb);
-                continue;
-            }
-        } else if (!luringcb->qiov) {
-            goto end;
-        } else if (total_bytes == luringcb->qiov->size) {
-            ret = 0;
-        /* Only read/write */
-        } else {
-            /* Short Read/Write */
-            if (luringcb->is_read) {
-                if (ret > 0) {
-                    luring_resubmit_short_read(s, luringcb, ret);
-                    continue;
-                } else {
-                    /* Pad with zeroes */
-                    qemu_iovec_memset(luringcb->qiov, total_bytes, 0,
-                                      luringcb->qiov->size - total_bytes);
-                    ret = 0;
-                }
-            } else {
-                ret = -ENOSPC;
-            }
-        }
-end:
-        luringcb->ret = ret;
-        qemu_iovec_destroy(&luringcb->resubmit_qiov);
-
-        /*
-         * If the coroutine is already entered it must be in ioq_submit()
-         * and will notice luringcb->ret has been filled in when it
-         * eventually runs later. Coroutines cannot be entered recursively
-         * so avoid doing that!
-         */
-        if (!qemu_coroutine_entered(luringcb->co)) {
-            aio_co_wake(luringcb->co);
-        }
+        luring_complete(s, luringcb, ret);
     }
     qemu_bh_cancel(s->completion_bh);
 }
@@ -359,6 +444,16 @@ static int luring_do_submit(int fd, LuringAIOCB *luringcb, LuringState *s,
     }
     io_uring_sqe_set_data(sqes, luringcb);
 
+    if (luring_use_aio_context_ring(s)) {
+        /* Batched with everything else until the event loop next waits */
+        luringcb->s = s;
+        luringcb->cqe_handler.cb = luring_cqe_handler;
+        aio_add_sqe(s->aio_context, luring_prep_sqe, luringcb,
+                    &luringcb->cqe_handler);
+        trace_luring_do_submit_aio_context(s, luringcb);
+        return 0;
+    }
+
     QSIMPLEQ_INSERT_TAIL(&s->io_q.submit_queue, luringcb, next);
     s->io_q.in_queue++;
     trace_luring_do_submit(s, s->io_q.blocked, s->io_q.plugged,
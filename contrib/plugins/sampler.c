@@ -0,0 +1,291 @@
+/*
+ * Sampling profiler
+ *
+ * Rather than calling out on every block, count the instructions each
+ * vCPU executes with an inline per-vCPU counter and only call back into
+ * the plugin when the count crosses the sampling period. The cost per
+ * block is an inline add and compare, so the guest runs at close to
+ * full speed while still producing a guest PC level profile.
+ *
+ * License: GNU GPL, version 2 or later.
+ *   See the COPYING file in the top-level directory.
+ */
+#include <inttypes.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <glib.h>
+
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+typedef enum {
+    FORMAT_FOLDED,
+    FORMAT_PERF,
+} OutputFormat;
+
+/* a prime period avoids aliasing with loops of a power of two size */
+static uint64_t period = 10007;
+static guint64 limit = 20;
+static char *outfile;
+static OutputFormat format = FORMAT_FOLDED;
+
+typedef struct {
+    uint64_t insns;     /* executed since the last sample */
+    uint64_t samples;
+} VCPUSampler;
+
+static struct qemu_plugin_scoreboard *vcpus;
+static qemu_plugin_u64 insns;
+static qemu_plugin_u64 samples;
+
+/* Plugins need to take care of their own locking */
+static GMutex lock;
+static GHashTable *blocks;
+
+/*
+ * Blocks are hashed by their start address; blocks that start at the same
+ * address but have a different length are chained behind the first one.
+ */
+typedef struct BlockSamples {
+    uint64_t vaddr;
+    size_t insns;
+    const char *symbol;
+    uint64_t samples;
+    struct BlockSamples *next;
+} BlockSamples;
+
+typedef struct {
+    const char *name;
+    uint64_t samples;
+} SymbolSamples;
+
+static gint cmp_symbol_samples(gconstpointer a, gconstpointer b)
+{
+    const SymbolSamples *sa = a;
+    const SymbolSamples *sb = b;
+    return sa->samples > sb->samples ? -1 : sa->samples < sb->samples;
+}
+
+static const char *block_symbol(BlockSamples *b, char **buf)
+{
+    if (b->symbol) {
+        return b->symbol;
+    }
+    g_free(*buf);
+    *buf = g_strdup_printf("0x%" PRIx64, b->vaddr);
+    return *buf;
+}
+
+static void write_samples(GList *recs)
+{
+    g_autofree char *pc_name = NULL;
+    FILE *f = fopen(outfile, "w");
+
+    if (!f) {
+        fprintf(stderr, "sampler: could not open %s: %s\n",
+                outfile, strerror(errno));
+        return;
+    }
+
+    if (format == FORMAT_FOLDED) {
+        /* one "frame count" line per symbol, as used by flamegraph tools */
+        g_autoptr(GHashTable) symbols = g_hash_table_new(NULL, NULL);
+        GHashTableIter iter;
+        gpointer key, value;
+
+        for (GList *it = recs; it; it = it->next) {
+            BlockSamples *b = it->data;
+            const char *name = g_intern_string(block_symbol(b, &pc_name));
+            gsize n = GPOINTER_TO_SIZE(g_hash_table_lookup(symbols, name));
+
+            g_hash_table_insert(symbols, (gpointer) name,
+                                GSIZE_TO_POINTER(n + b->samples));
+        }
+        g_hash_table_iter_init(&iter, symbols);
+        while (g_hash_table_iter_next(&iter, &key, &value)) {
+            fprintf(f, "%s %zu\n", (char *) key, GPOINTER_TO_SIZE(value));
+        }
+    } else {
+        /* one record per sample, in the format printed by "perf script" */
+        for (GList *it = recs; it; it = it->next) {
+            BlockSamples *b = it->data;
+            const char *name = block_symbol(b, &pc_name);
+
+            for (uint64_t i = 0; i < b->samples; i++) {
+                fprintf(f, "qemu-guest 0 0.000000: %" PRIu64
+                        " instructions:\n"
+                        "\t%16" PRIx64 " %s (guest)\n\n",
+                        period, b->vaddr, name);
+            }
+        }
+    }
+    fclose(f);
+}
+
+static void report_symbols(GList *recs, GString *report)
+{
+    g_autoptr(GHashTable) symbols = g_hash_table_new_full(NULL, NULL,
+                                                          NULL, g_free);
+    g_autofree char *pc_name = NULL;
+    uint64_t total = qemu_plugin_u64_sum(samples);
+    GList *sorted, *it;
+    guint64 i;
+
+    for (it = recs; it; it = it->next) {
+        BlockSamples *b = it->data;
+        const char *name = g_intern_string(block_symbol(b, &pc_name));
+        SymbolSamples *s = g_hash_table_lookup(symbols, name);
+
+        if (!s) {
+            s = g_new0(SymbolSamples, 1);
+            s->name = name;
+            g_hash_table_insert(symbols, (gpointer) name, s);
+        }
+        s->samples += b->samples;
+    }
+
+    g_string_append_printf(report, "%" PRIu64 " samples, period %" PRIu64
+                           " instructions\n", total, period);
+    if (!total) {
+        return;
+    }
+    g_string_append(report, "samples, percent, symbol\n");
+
+    sorted = g_list_sort(g_hash_table_get_values(symbols),
+                         cmp_symbol_samples);
+    for (i = 0, it = sorted; i < limit && it; i++, it = it->next) {
+        SymbolSamples *s = it->data;
+        g_string_append_printf(report, "%" PRIu64 ", %.2f%%, %s\n",
+                               s->samples, s->samples * 100.0 / total,
+                               s->name);
+    }
+    g_list_free(sorted);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *p)
+{
+    g_autoptr(GString) report = g_string_new("");
+    GList *recs = NULL;
+    GHashTableIter iter;
+    gpointer value;
+
+    g_mutex_lock(&lock);
+    g_hash_table_iter_init(&iter, blocks);
+    while (g_hash_table_iter_next(&iter, NULL, &value)) {
+        for (BlockSamples *b = value; b; b = b->next) {
+            recs = g_list_prepend(recs, b);
+        }
+    }
+
+    report_symbols(recs, report);
+    if (outfile) {
+        write_samples(recs);
+    }
+
+    g_list_free(recs);
+    g_mutex_unlock(&lock);
+
+    qemu_plugin_outs(report->str);
+    qemu_plugin_scoreboard_free(vcpus);
+}
+
+static void vcpu_sample(unsigned int cpu_index, void *udata)
+{
+    BlockSamples *b = udata;
+
+    qemu_plugin_u64_set(insns, cpu_index, 0);
+    qemu_plugin_u64_add(samples, cpu_index, 1);
+
+    g_mutex_lock(&lock);
+    b->samples++;
+    g_mutex_unlock(&lock);
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    BlockSamples *head, *b;
+    uint64_t pc = qemu_plugin_tb_vaddr(tb);
+    size_t n = qemu_plugin_tb_n_insns(tb);
+
+    g_mutex_lock(&lock);
+    head = g_hash_table_lookup(blocks, &pc);
+    b = head;
+    while (b && b->insns != n) {
+        b = b->next;
+    }
+    if (!b) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, 0);
+        const char *sym = qemu_plugin_insn_symbol(insn);
+
+        b = g_new0(BlockSamples, 1);
+        b->vaddr = pc;
+        b->insns = n;
+        b->symbol = sym ? g_intern_string(sym) : NULL;
+        if (head) {
+            b->next = head->next;
+            head->next = b;
+        } else {
+            g_hash_table_insert(blocks, &b->vaddr, b);
+        }
+    }
+    g_mutex_unlock(&lock);
+
+    /*
+     * The conditional callback is injected before the inline add, so a
+     * sample is attributed to the block that starts once the period has
+     * elapsed.
+     */
+    qemu_plugin_register_vcpu_tb_exec_cond_cb(tb, vcpu_sample,
+                                              QEMU_PLUGIN_CB_NO_REGS,
+                                              QEMU_PLUGIN_COND_GE,
+                                              insns, period, b);
+    qemu_plugin_register_vcpu_tb_exec_inline_per_vcpu(
+        tb, QEMU_PLUGIN_INLINE_ADD_U64, insns, n);
+}
+
+QEMU_PLUGIN_EXPORT
+int qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info,
+                        int argc, char **argv)
+{
+    for (int i = 0; i < argc; i++) {
+        char *opt = argv[i];
+        g_auto(GStrv) tokens = g_strsplit(opt, "=", 2);
+
+        if (g_strcmp0(tokens[0], "period") == 0) {
+            period = g_ascii_strtoull(tokens[1], NULL, 10);
+            if (!period) {
+                fprintf(stderr, "period must be greater than 0: %s\n", opt);
+                return -1;
+            }
+        } else if (g_strcmp0(tokens[0], "limit") == 0) {
+            limit = g_ascii_strtoull(tokens[1], NULL, 10);
+        } else if (g_strcmp0(tokens[0], "outfile") == 0) {
+            outfile = g_strdup(tokens[1]);
+        } else if (g_strcmp0(tokens[0], "format") == 0) {
+            if (g_strcmp0(tokens[1], "folded") == 0) {
+                format = FORMAT_FOLDED;
+            } else if (g_strcmp0(tokens[1], "perf") == 0) {
+                format = FORMAT_PERF;
+            } else {
+                fprintf(stderr, "invalid format: %s\n", opt);
+                return -1;
+            }
+        } else {
+            fprintf(stderr, "option parsing failed: %s\n", opt);
+            return -1;
+        }
+    }
+
+    blocks = g_hash_table_new(g_int64_hash, g_int64_equal);
+    vcpus = qemu_plugin_scoreboard_new(sizeof(VCPUSampler));
+    insns = qemu_plugin_scoreboard_u64_in_struct(vcpus, VCPUSampler, insns);
+    samples = qemu_plugin_scoreboard_u64_in_struct(vcpus, VCPUSampler,
+                                                   samples);
+
+    qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}
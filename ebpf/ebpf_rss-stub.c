@@ -34,6 +34,23 @@ bool ebpf_rss_set_all(struct EBPFRSSContext *ctx, struct EBPFRSSConfig *config,
     return false;
 }
 
+bool ebpf_rss_set_flow(struct EBPFRSSContext *ctx,
+                       const struct EBPFRSSFlowKey *key, uint16_t queue)
+{
+    return false;
+}
+
+bool ebpf_rss_set_queue_load(struct EBPFRSSContext *ctx, uint16_t queue,
+                             uint32_t load)
+{
+    return false;
+}
+
+void ebpf_rss_flush_flows(struct EBPFRSSContext *ctx)
+{
+
+}
+
 void ebpf_rss_unload(struct EBPFRSSContext *ctx)
 {
 
@@ -65,6 +65,9 @@ bool ebpf_rss_load(struct EBPFRSSContext *ctx)
             rss_bpf_ctx->maps.tap_rss_map_indirection_table);
     ctx->map_toeplitz_key = bpf_map__fd(
             rss_bpf_ctx->maps.tap_rss_map_toeplitz_key);
+    ctx->map_flows = bpf_map__fd(rss_bpf_ctx->maps.tap_rss_map_flows);
+    ctx->map_queue_load = bpf_map__fd(
+            rss_bpf_ctx->maps.tap_rss_map_queue_load);
 
     return true;
 error:
@@ -154,6 +157,51 @@ bool ebpf_rss_set_all(struct EBPFRSSContext *ctx, struct EBPFRSSConfig *config,
     return true;
 }
 
+bool ebpf_rss_set_flow(struct EBPFRSSContext *ctx,
+                       const struct EBPFRSSFlowKey *key, uint16_t queue)
+{
+    if (!ebpf_rss_is_loaded(ctx) || key == NULL) {
+        return false;
+    }
+
+    if (bpf_map_update_elem(ctx->map_flows, key, &queue, BPF_ANY) < 0) {
+        trace_ebpf_error("eBPF RSS", "can not update flow steering map");
+        return false;
+    }
+    return true;
+}
+
+bool ebpf_rss_set_queue_load(struct EBPFRSSContext *ctx, uint16_t queue,
+                             uint32_t load)
+{
+    uint32_t map_key = queue;
+
+    if (!ebpf_rss_is_loaded(ctx)) {
+        return false;
+    }
+
+    if (bpf_map_update_elem(ctx->map_queue_load, &map_key, &load, 0) < 0) {
+        return false;
+    }
+    return true;
+}
+
+void ebpf_rss_flush_flows(struct EBPFRSSContext *ctx)
+{
+    struct EBPFRSSFlowKey key;
+
+    if (!ebpf_rss_is_loaded(ctx)) {
+        return;
+    }
+
+    /* deleting the current key restarts the walk from the first entry */
+    while (!bpf_map_get_next_key(ctx->map_flows, NULL, &key)) {
+        if (bpf_map_delete_elem(ctx->map_flows, &key) < 0) {
+            break;
+        }
+    }
+}
+
 void ebpf_rss_unload(struct EBPFRSSContext *ctx)
 {
     if (!ebpf_rss_is_loaded(ctx)) {
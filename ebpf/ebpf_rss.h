@@ -20,6 +20,8 @@ struct EBPFRSSContext {
     int map_configuration;
     int map_toeplitz_key;
     int map_indirections_table;
+    int map_flows;
+    int map_queue_load;
 };
 
 struct EBPFRSSConfig {
@@ -28,8 +30,21 @@ struct EBPFRSSConfig {
     uint32_t hash_types;
     uint16_t indirections_len;
     uint16_t default_queue;
+    uint8_t flow_steering;
+    uint8_t load_balance;
+    uint16_t queues;
 } __attribute__((packed));
 
+/* Receive direction 5-tuple, addresses and ports in network byte order */
+struct EBPFRSSFlowKey {
+    uint8_t src[16];
+    uint8_t dst[16];
+    uint16_t src_port;
+    uint16_t dst_port;
+    uint8_t proto;
+    uint8_t pad[3];
+};
+
 void ebpf_rss_init(struct EBPFRSSContext *ctx);
 
 bool ebpf_rss_is_loaded(struct EBPFRSSContext *ctx);
@@ -39,6 +54,14 @@ bool ebpf_rss_load(struct EBPFRSSContext *ctx);
 bool ebpf_rss_set_all(struct EBPFRSSContext *ctx, struct EBPFRSSConfig *config,
                       uint16_t *indirections_table, uint8_t *toeplitz_key);
 
+bool ebpf_rss_set_flow(struct EBPFRSSContext *ctx,
+                       const struct EBPFRSSFlowKey *key, uint16_t queue);
+
+bool ebpf_rss_set_queue_load(struct EBPFRSSContext *ctx, uint16_t queue,
+                             uint32_t load);
+
+void ebpf_rss_flush_flows(struct EBPFRSSContext *ctx);
+
 void ebpf_rss_unload(struct EBPFRSSContext *ctx);
 
 #endif /* QEMU_EBPF_RSS_H */
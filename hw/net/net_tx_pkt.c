@@ -301,6 +301,22 @@ func_exit:
     return rc;
 }
 
+bool net_tx_pkt_build_vheader_uso(struct NetTxPkt *pkt, uint32_t gso_size)
+{
+    assert(pkt);
+
+    if (pkt->l4proto != IP_PROTO_UDP || !gso_size ||
+        !net_tx_pkt_build_vheader(pkt, false, true, 0)) {
+        return false;
+    }
+
+    pkt->virt_hdr.gso_type = VIRTIO_NET_HDR_GSO_UDP_L4;
+    pkt->virt_hdr.hdr_len = pkt->hdr_len + sizeof(struct udp_header);
+    pkt->virt_hdr.gso_size = gso_size;
+
+    return true;
+}
+
 bool net_tx_pkt_build_vheader(struct NetTxPkt *pkt, bool tso_enable,
     bool csum_enable, uint32_t gso_size)
 {
@@ -399,6 +415,7 @@ bool net_tx_pkt_add_raw_fragment(struct NetTxPkt *pkt, hwaddr pa,
         return true;
      }
 
+    assert(pkt->pci_dev);
     ventry = &pkt->raw[pkt->raw_frags];
     mapped_len = len;
 
@@ -414,6 +431,23 @@ bool net_tx_pkt_add_raw_fragment(struct NetTxPkt *pkt, hwaddr pa,
     }
 }
 
+bool net_tx_pkt_add_raw_fragment_host(struct NetTxPkt *pkt, void *base,
+                                      size_t len)
+{
+    assert(pkt && !pkt->pci_dev);
+
+    if (pkt->raw_frags >= pkt->max_raw_frags) {
+        return false;
+    }
+
+    if (len) {
+        pkt->raw[pkt->raw_frags].iov_base = base;
+        pkt->raw[pkt->raw_frags].iov_len = len;
+        pkt->raw_frags++;
+    }
+    return true;
+}
+
 bool net_tx_pkt_has_fragments(struct NetTxPkt *pkt)
 {
     return pkt->raw_frags > 0;
@@ -461,7 +495,8 @@ void net_tx_pkt_reset(struct NetTxPkt *pkt, PCIDevice *pci_dev)
     pkt->payload_len = 0;
     pkt->payload_frags = 0;
 
-    if (pkt->max_raw_frags > 0) {
+    /* fragments of a packet without a PCI device are not mapped here */
+    if (pkt->max_raw_frags > 0 && pkt->pci_dev) {
         assert(pkt->raw);
         for (i = 0; i < pkt->raw_frags; i++) {
             assert(pkt->raw[i].iov_base);
@@ -566,17 +601,17 @@ static void net_tx_pkt_sendv(
     }
 }
 
-static bool net_tx_pkt_tcp_fragment_init(struct NetTxPkt *pkt,
-                                         struct iovec *fragment,
-                                         int *pl_idx,
-                                         size_t *l4hdr_len,
-                                         int *src_idx,
-                                         size_t *src_offset,
-                                         size_t *src_len)
+/* Copy the L4 header, which is repeated in every segment */
+static bool net_tx_pkt_l4_fragment_init(struct NetTxPkt *pkt,
+                                        struct iovec *fragment,
+                                        int *pl_idx,
+                                        size_t *l4hdr_len,
+                                        int *src_idx,
+                                        size_t *src_offset,
+                                        size_t *src_len)
 {
     struct iovec *l4 = fragment + NET_TX_PKT_PL_START_FRAG;
     size_t bytes_read = 0;
-    struct tcp_hdr *th;
 
     if (!pkt->payload_frags) {
         return false;
@@ -603,9 +638,6 @@ static bool net_tx_pkt_tcp_fragment_init(struct NetTxPkt *pkt,
     memcpy((char *)l4->iov_base + bytes_read, pkt->vec[*src_idx].iov_base,
            *src_offset);
 
-    th = l4->iov_base;
-    th->th_flags &= ~(TH_FIN | TH_PUSH);
-
     *pl_idx = NET_TX_PKT_PL_START_FRAG + 1;
     *l4hdr_len = l4->iov_len;
     *src_len = pkt->virt_hdr.gso_size;
@@ -613,7 +645,28 @@ static bool net_tx_pkt_tcp_fragment_init(struct NetTxPkt *pkt,
     return true;
 }
 
-static void net_tx_pkt_tcp_fragment_deinit(struct iovec *fragment)
+static bool net_tx_pkt_tcp_fragment_init(struct NetTxPkt *pkt,
+                                         struct iovec *fragment,
+                                         int *pl_idx,
+                                         size_t *l4hdr_len,
+                                         int *src_idx,
+                                         size_t *src_offset,
+                                         size_t *src_len)
+{
+    struct tcp_hdr *th;
+
+    if (!net_tx_pkt_l4_fragment_init(pkt, fragment, pl_idx, l4hdr_len,
+                                     src_idx, src_offset, src_len)) {
+        return false;
+    }
+
+    th = fragment[NET_TX_PKT_PL_START_FRAG].iov_base;
+    th->th_flags &= ~(TH_FIN | TH_PUSH);
+
+    return true;
+}
+
+static void net_tx_pkt_l4_fragment_deinit(struct iovec *fragment)
 {
     g_free(fragment[NET_TX_PKT_PL_START_FRAG].iov_base);
 }
@@ -696,6 +749,42 @@ static void net_tx_pkt_udp_fragment_fix(struct NetTxPkt *pkt,
     eth_fix_ip4_checksum(l3hdr->iov_base, l3hdr->iov_len);
 }
 
+static void net_tx_pkt_udp_l4_fragment_fix(struct NetTxPkt *pkt,
+                                           struct iovec *fragment,
+                                           size_t fragment_len)
+{
+    struct iovec *l2hdr = fragment + NET_TX_PKT_L2HDR_FRAG;
+    struct iovec *l3hdr = fragment + NET_TX_PKT_L3HDR_FRAG;
+    struct iovec *l4hdr = fragment + NET_TX_PKT_PL_START_FRAG;
+    struct udp_hdr *uh = l4hdr->iov_base;
+    size_t len = l4hdr->iov_len + fragment_len;
+
+    uh->uh_ulen = cpu_to_be16(len);
+
+    if (eth_get_l3_proto(l2hdr, 1, l2hdr->iov_len) == ETH_P_IP) {
+        struct ip_header *ip = l3hdr->iov_base;
+
+        ip->ip_len = cpu_to_be16(l3hdr->iov_len + len);
+        eth_fix_ip4_checksum(l3hdr->iov_base, l3hdr->iov_len);
+    } else {
+        struct ip6_header *ip6 = l3hdr->iov_base;
+
+        ip6->ip6_plen = cpu_to_be16(l3hdr->iov_len - sizeof(*ip6) + len);
+    }
+}
+
+static void net_tx_pkt_udp_l4_fragment_advance(struct NetTxPkt *pkt,
+                                               struct iovec *fragment)
+{
+    struct iovec *l2hdr = fragment + NET_TX_PKT_L2HDR_FRAG;
+    struct iovec *l3hdr = fragment + NET_TX_PKT_L3HDR_FRAG;
+    struct ip_header *ip = l3hdr->iov_base;
+
+    if (eth_get_l3_proto(l2hdr, 1, l2hdr->iov_len) == ETH_P_IP) {
+        ip->ip_id = cpu_to_be16(be16_to_cpu(ip->ip_id) + 1);
+    }
+}
+
 static bool net_tx_pkt_do_sw_fragmentation(struct NetTxPkt *pkt,
                                            NetTxPktCallback callback,
                                            void *context)
@@ -738,6 +827,13 @@ static bool net_tx_pkt_do_sw_fragmentation(struct NetTxPkt *pkt,
                                      &src_idx, &src_offset, &src_len);
         break;
 
+    case VIRTIO_NET_HDR_GSO_UDP_L4:
+        if (!net_tx_pkt_l4_fragment_init(pkt, fragment, &pl_idx, &l4hdr_len,
+                                         &src_idx, &src_offset, &src_len)) {
+            return false;
+        }
+        break;
+
     default:
         abort();
     }
@@ -764,6 +860,13 @@ static bool net_tx_pkt_do_sw_fragmentation(struct NetTxPkt *pkt,
             net_tx_pkt_udp_fragment_fix(pkt, fragment, fragment_offset,
                                         fragment_len);
             break;
+
+        case VIRTIO_NET_HDR_GSO_UDP_L4:
+            net_tx_pkt_udp_l4_fragment_fix(pkt, fragment, fragment_len);
+            net_tx_pkt_do_sw_csum(pkt, fragment + NET_TX_PKT_L2HDR_FRAG,
+                                  dst_idx - NET_TX_PKT_L2HDR_FRAG,
+                                  l4hdr_len + fragment_len);
+            break;
         }
 
         callback(context,
@@ -774,14 +877,15 @@ static bool net_tx_pkt_do_sw_fragmentation(struct NetTxPkt *pkt,
             gso_type == VIRTIO_NET_HDR_GSO_TCPV6) {
             net_tx_pkt_tcp_fragment_advance(pkt, fragment, fragment_len,
                                             gso_type);
+        } else if (gso_type == VIRTIO_NET_HDR_GSO_UDP_L4) {
+            net_tx_pkt_udp_l4_fragment_advance(pkt, fragment);
         }
 
         fragment_offset += fragment_len;
     }
 
-    if (gso_type == VIRTIO_NET_HDR_GSO_TCPV4 ||
-        gso_type == VIRTIO_NET_HDR_GSO_TCPV6) {
-        net_tx_pkt_tcp_fragment_deinit(fragment);
+    if (gso_type != VIRTIO_NET_HDR_GSO_UDP) {
+        net_tx_pkt_l4_fragment_deinit(fragment);
     }
 
     return true;
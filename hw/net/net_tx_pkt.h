@@ -32,7 +32,8 @@ typedef void (* NetTxPktCallback)(void *, const struct iovec *, int, const struc
  * Init function for tx packet functionality
  *
  * @pkt:            packet pointer
- * @pci_dev:        PCI device processing this packet
+ * @pci_dev:        PCI device processing this packet, or NULL if the
+ *                  fragments are added with net_tx_pkt_add_raw_fragment_host
  * @max_frags:      max tx ip fragments
  */
 void net_tx_pkt_init(struct NetTxPkt **pkt, PCIDevice *pci_dev,
@@ -66,6 +67,16 @@ struct virtio_net_hdr *net_tx_pkt_get_vhdr(struct NetTxPkt *pkt);
 bool net_tx_pkt_build_vheader(struct NetTxPkt *pkt, bool tso_enable,
     bool csum_enable, uint32_t gso_size);
 
+/**
+ * build virtio header for UDP segmentation offload (USO)
+ *
+ * @pkt:            packet
+ * @gso_size:       payload size of each UDP datagram
+ * @ret:            false if the packet is not UDP
+ *
+ */
+bool net_tx_pkt_build_vheader_uso(struct NetTxPkt *pkt, uint32_t gso_size);
+
 /**
 * updates vlan tag, and adds vlan header with custom ethernet type
 * in case it is missing.
@@ -102,6 +113,19 @@ net_tx_pkt_setup_vlan_header(struct NetTxPkt *pkt, uint16_t vlan)
 bool net_tx_pkt_add_raw_fragment(struct NetTxPkt *pkt, hwaddr pa,
     size_t len);
 
+/**
+ * populate data fragment that is already in host memory into pkt context.
+ * Only for packets without a PCI device, the caller keeps @base valid
+ * until the packet is reset.
+ *
+ * @pkt:            packet
+ * @base:           host address of fragment
+ * @len:            length of fragment
+ *
+ */
+bool net_tx_pkt_add_raw_fragment_host(struct NetTxPkt *pkt, void *base,
+    size_t len);
+
 /**
  * Fix ip header fields and calculate IP header and pseudo header checksums.
  *
@@ -0,0 +1,172 @@
+/*
+ * virtio-net RSS flow table
+ *
+ * Remembers the queue the guest last transmitted each TCP or UDP flow on,
+ * so that received packets of the flow can be steered to the same queue.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#include "qemu/osdep.h"
+#include "qemu/bswap.h"
+#include "qemu/xxhash.h"
+#include "virtio-net-flow.h"
+
+#define VIRTIO_NET_FLOW_TABLE_SIZE      1024
+#define VIRTIO_NET_FLOW_TABLE_WAYS      4
+
+/* Queue the guest last transmitted a flow on, keyed by the RX 5-tuple */
+typedef struct VirtioNetFlow {
+    struct EBPFRSSFlowKey key;
+    uint32_t last_used;
+    uint16_t queue;
+    bool valid;
+} VirtioNetFlow;
+
+struct VirtioNetFlowTable {
+    VirtioNetFlow flows[VIRTIO_NET_FLOW_TABLE_SIZE];
+    uint32_t clock;
+};
+
+VirtioNetFlowTable *virtio_net_flow_table_new(void)
+{
+    return g_new0(VirtioNetFlowTable, 1);
+}
+
+void virtio_net_flow_table_free(VirtioNetFlowTable *table)
+{
+    g_free(table);
+}
+
+void virtio_net_flow_table_reset(VirtioNetFlowTable *table)
+{
+    memset(table, 0, sizeof(*table));
+}
+
+bool virtio_net_flow_key(bool hasip4, bool hasip6,
+                         eth_ip4_hdr_info *ip4, eth_ip6_hdr_info *ip6,
+                         eth_l4_hdr_info *l4, bool reply,
+                         struct EBPFRSSFlowKey *key)
+{
+    const void *saddr, *daddr;
+    uint16_t sport, dport;
+    size_t alen;
+
+    memset(key, 0, sizeof(*key));
+    switch (l4->proto) {
+    case ETH_L4_HDR_PROTO_TCP:
+        key->proto = IP_PROTO_TCP;
+        sport = l4->hdr.tcp.th_sport;
+        dport = l4->hdr.tcp.th_dport;
+        break;
+    case ETH_L4_HDR_PROTO_UDP:
+        key->proto = IP_PROTO_UDP;
+        sport = l4->hdr.udp.uh_sport;
+        dport = l4->hdr.udp.uh_dport;
+        break;
+    default:
+        return false;
+    }
+
+    if (hasip4) {
+        saddr = &ip4->ip4_hdr.ip_src;
+        daddr = &ip4->ip4_hdr.ip_dst;
+        alen = sizeof(ip4->ip4_hdr.ip_src);
+    } else if (hasip6) {
+        saddr = &ip6->ip6_hdr.ip6_src;
+        daddr = &ip6->ip6_hdr.ip6_dst;
+        alen = sizeof(ip6->ip6_hdr.ip6_src);
+    } else {
+        return false;
+    }
+
+    if (reply) {
+        memcpy(key->src, daddr, alen);
+        memcpy(key->dst, saddr, alen);
+        key->src_port = dport;
+        key->dst_port = sport;
+    } else {
+        memcpy(key->src, saddr, alen);
+        memcpy(key->dst, daddr, alen);
+        key->src_port = sport;
+        key->dst_port = dport;
+    }
+    return true;
+}
+
+/*
+ * The table is set associative, so that a few colliding flows do not keep
+ * evicting each other and rewriting the eBPF flow map.  Returns the entry
+ * for @key, or NULL if it is not in the table.  If @victim is not NULL, it
+ * is set to the least recently used entry of the set.
+ */
+static VirtioNetFlow *virtio_net_flow_find(VirtioNetFlowTable *table,
+                                           const struct EBPFRSSFlowKey *key,
+                                           VirtioNetFlow **victim)
+{
+    VirtioNetFlow *set, *lru;
+    uint32_t hash;
+    int i;
+
+    hash = qemu_xxhash6(ldq_he_p(key->src) ^ ldq_he_p(key->src + 8),
+                        ldq_he_p(key->dst) ^ ldq_he_p(key->dst + 8),
+                        (uint32_t)key->src_port << 16 | key->dst_port,
+                        key->proto);
+    set = &table->flows[(hash * VIRTIO_NET_FLOW_TABLE_WAYS) &
+                        (VIRTIO_NET_FLOW_TABLE_SIZE - 1)];
+
+    lru = &set[0];
+    for (i = 0; i < VIRTIO_NET_FLOW_TABLE_WAYS; i++) {
+        if (set[i].valid && !memcmp(&set[i].key, key, sizeof(*key))) {
+            return &set[i];
+        }
+        if (!lru->valid) {
+            continue;
+        }
+        if (!set[i].valid ||
+            (int32_t)(set[i].last_used - lru->last_used) < 0) {
+            lru = &set[i];
+        }
+    }
+
+    if (victim) {
+        *victim = lru;
+    }
+    return NULL;
+}
+
+bool virtio_net_flow_learn(VirtioNetFlowTable *table,
+                           const struct EBPFRSSFlowKey *key, uint16_t queue)
+{
+    VirtioNetFlow *flow, *victim;
+
+    flow = virtio_net_flow_find(table, key, &victim);
+    if (!flow) {
+        flow = victim;
+        flow->key = *key;
+        flow->valid = true;
+    } else if (flow->queue == queue) {
+        flow->last_used = ++table->clock;
+        return false;
+    }
+
+    flow->last_used = ++table->clock;
+    flow->queue = queue;
+    return true;
+}
+
+bool virtio_net_flow_lookup(VirtioNetFlowTable *table,
+                            const struct EBPFRSSFlowKey *key,
+                            uint16_t *queue)
+{
+    VirtioNetFlow *flow = virtio_net_flow_find(table, key, NULL);
+
+    if (!flow) {
+        return false;
+    }
+
+    *queue = flow->queue;
+    return true;
+}
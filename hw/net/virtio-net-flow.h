@@ -0,0 +1,77 @@
+/*
+ * virtio-net RSS flow table
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ *
+ */
+
+#ifndef VIRTIO_NET_FLOW_H
+#define VIRTIO_NET_FLOW_H
+
+#include "net/eth.h"
+#include "ebpf/ebpf_rss.h"
+
+typedef struct VirtioNetFlowTable VirtioNetFlowTable;
+
+/**
+ * Allocate an empty flow table
+ */
+VirtioNetFlowTable *virtio_net_flow_table_new(void);
+
+/**
+ * Free a flow table
+ *
+ * @table:          flow table, may be NULL
+ */
+void virtio_net_flow_table_free(VirtioNetFlowTable *table);
+
+/**
+ * Forget all flows
+ *
+ * @table:          flow table
+ */
+void virtio_net_flow_table_reset(VirtioNetFlowTable *table);
+
+/**
+ * Build the receive direction flow key of a TCP or UDP packet
+ *
+ * @hasip4:         the packet is IPv4, @ip4 is valid
+ * @hasip6:         the packet is IPv6, @ip6 is valid
+ * @ip4:            IPv4 header info
+ * @ip6:            IPv6 header info
+ * @l4:             L4 header info
+ * @reply:          the packet is sent by the guest, swap the endpoints
+ * @key:            flow key
+ * @ret:            false if the packet is not TCP or UDP over IP
+ */
+bool virtio_net_flow_key(bool hasip4, bool hasip6,
+                         eth_ip4_hdr_info *ip4, eth_ip6_hdr_info *ip6,
+                         eth_l4_hdr_info *l4, bool reply,
+                         struct EBPFRSSFlowKey *key);
+
+/**
+ * Remember the queue a flow was last transmitted on.  When the set of
+ * the flow is full, its least recently used flow is replaced.
+ *
+ * @table:          flow table
+ * @key:            flow key
+ * @queue:          queue index
+ * @ret:            true if the flow is new or moved to @queue
+ */
+bool virtio_net_flow_learn(VirtioNetFlowTable *table,
+                           const struct EBPFRSSFlowKey *key, uint16_t queue);
+
+/**
+ * Look up the queue a flow was last transmitted on
+ *
+ * @table:          flow table
+ * @key:            flow key
+ * @queue:          queue index
+ * @ret:            false if the flow is not in the table
+ */
+bool virtio_net_flow_lookup(VirtioNetFlowTable *table,
+                            const struct EBPFRSSFlowKey *key,
+                            uint16_t *queue);
+
+#endif
@@ -20,6 +20,7 @@
 #include "hw/virtio/virtio.h"
 #include "net/net.h"
 #include "net/checksum.h"
+#include "net/gro.h"
 #include "net/tap.h"
 #include "qemu/error-report.h"
 #include "qemu/timer.h"
@@ -44,6 +45,8 @@
 #include "monitor/qdev.h"
 #include "hw/pci/pci_device.h"
 #include "net_rx_pkt.h"
+#include "net_tx_pkt.h"
+#include "virtio-net-flow.h"
 #include "hw/virtio/vhost.h"
 #include "sysemu/qtest.h"
 
@@ -786,10 +789,12 @@ static uint64_t virtio_net_get_features(VirtIODevice *vdev, uint64_t features,
     virtio_add_feature(&features, VIRTIO_NET_F_MAC);
 
     if (!peer_has_vnet_hdr(n)) {
-        virtio_clear_feature(&features, VIRTIO_NET_F_CSUM);
-        virtio_clear_feature(&features, VIRTIO_NET_F_HOST_TSO4);
-        virtio_clear_feature(&features, VIRTIO_NET_F_HOST_TSO6);
-        virtio_clear_feature(&features, VIRTIO_NET_F_HOST_ECN);
+        if (!n->sw_gso) {
+            virtio_clear_feature(&features, VIRTIO_NET_F_CSUM);
+            virtio_clear_feature(&features, VIRTIO_NET_F_HOST_TSO4);
+            virtio_clear_feature(&features, VIRTIO_NET_F_HOST_TSO6);
+            virtio_clear_feature(&features, VIRTIO_NET_F_HOST_ECN);
+        }
 
         virtio_clear_feature(&features, VIRTIO_NET_F_GUEST_CSUM);
         virtio_clear_feature(&features, VIRTIO_NET_F_GUEST_TSO4);
@@ -801,7 +806,14 @@ static uint64_t virtio_net_get_features(VirtIODevice *vdev, uint64_t features,
 
     if (!peer_has_vnet_hdr(n) || !peer_has_ufo(n)) {
         virtio_clear_feature(&features, VIRTIO_NET_F_GUEST_UFO);
-        virtio_clear_feature(&features, VIRTIO_NET_F_HOST_UFO);
+        if (!n->sw_gso) {
+            virtio_clear_feature(&features, VIRTIO_NET_F_HOST_UFO);
+        }
+    }
+
+    /* No backend takes USO packets, they are always segmented here */
+    if (!n->sw_gso || get_vhost_net(nc->peer)) {
+        virtio_clear_feature(&features, VIRTIO_NET_F_HOST_USO);
     }
 
     if (!get_vhost_net(nc->peer)) {
@@ -1248,6 +1260,16 @@ static int virtio_net_handle_announce(VirtIONet *n, uint8_t cmd,
 
 static void virtio_net_detach_epbf_rss(VirtIONet *n);
 
+static void virtio_net_flow_reset(VirtIONet *n)
+{
+    if (!n->flows) {
+        return;
+    }
+
+    virtio_net_flow_table_reset(n->flows);
+    ebpf_rss_flush_flows(&n->ebpf_rss);
+}
+
 static void virtio_net_disable_rss(VirtIONet *n)
 {
     if (n->rss_data.enabled) {
@@ -1256,6 +1278,7 @@ static void virtio_net_disable_rss(VirtIONet *n)
     n->rss_data.enabled = false;
 
     virtio_net_detach_epbf_rss(n);
+    virtio_net_flow_reset(n);
 }
 
 static bool virtio_net_attach_ebpf_to_backend(NICState *nic, int prog_fd)
@@ -1278,7 +1301,7 @@ static void rss_data_to_rss_config(struct VirtioNetRssData *data,
     config->default_queue = data->default_queue;
 }
 
-static bool virtio_net_attach_epbf_rss(VirtIONet *n)
+static bool virtio_net_attach_epbf_rss(VirtIONet *n, uint16_t queue_pairs)
 {
     struct EBPFRSSConfig config = {};
 
@@ -1287,6 +1310,8 @@ static bool virtio_net_attach_epbf_rss(VirtIONet *n)
     }
 
     rss_data_to_rss_config(&n->rss_data, &config);
+    config.flow_steering = config.load_balance = n->flows != NULL;
+    config.queues = MIN(queue_pairs, n->max_queue_pairs);
 
     if (!ebpf_rss_set_all(&n->ebpf_rss, &config,
                           n->rss_data.indirections_table, n->rss_data.key)) {
@@ -1433,9 +1458,10 @@ static uint16_t virtio_net_handle_rss(VirtIONet *n,
         goto error;
     }
     n->rss_data.enabled = true;
+    virtio_net_flow_reset(n);
 
     if (!n->rss_data.populate_hash) {
-        if (!virtio_net_attach_epbf_rss(n)) {
+        if (!virtio_net_attach_epbf_rss(n, queue_pairs)) {
             /* EBPF must be loaded for vhost */
             if (get_vhost_net(qemu_get_queue(n->nic)->peer)) {
                 warn_report("Can't load eBPF RSS for vhost");
@@ -1585,11 +1611,47 @@ static void virtio_net_handle_ctrl(VirtIODevice *vdev, VirtQueue *vq)
 
 /* RX */
 
+/*
+ * A queue can run out of buffers and get them back many times per
+ * millisecond.  Mark it as loaded in the eBPF queue load map at most once
+ * per interval.  Getting buffers back is always published at once, so
+ * that a queue is never left marked as loaded; a loaded state that was
+ * held back is published by the next receive attempt that finds the queue
+ * still out of buffers.
+ */
+#define VIRTIO_NET_RX_LOAD_INTERVAL_NS  SCALE_MS
+
+static void virtio_net_set_rx_starved(VirtIONetQueue *q, bool starved)
+{
+    VirtIONet *n = q->n;
+    int64_t now;
+
+    if (!n->flows) {
+        return;
+    }
+
+    q->rx_starved = starved;
+    if (q->rx_starved_published == starved) {
+        return;
+    }
+
+    now = qemu_clock_get_ns(QEMU_CLOCK_REALTIME);
+    if (starved &&
+        now - q->rx_starved_published_ns < VIRTIO_NET_RX_LOAD_INTERVAL_NS) {
+        return;
+    }
+
+    q->rx_starved_published = starved;
+    q->rx_starved_published_ns = now;
+    ebpf_rss_set_queue_load(&n->ebpf_rss, q - n->vqs, starved);
+}
+
 static void virtio_net_handle_rx(VirtIODevice *vdev, VirtQueue *vq)
 {
     VirtIONet *n = VIRTIO_NET(vdev);
     int queue_index = vq2q(virtio_get_queue_index(vq));
 
+    virtio_net_set_rx_starved(&n->vqs[queue_index], false);
     qemu_flush_queued_packets(qemu_get_subqueue(n->nic, queue_index));
 }
 
@@ -1630,11 +1692,13 @@ static int virtio_net_has_buffers(VirtIONetQueue *q, int bufsize)
         if (virtio_queue_empty(q->rx_vq) ||
             (n->mergeable_rx_bufs &&
              !virtqueue_avail_bytes(q->rx_vq, bufsize, 0))) {
+            virtio_net_set_rx_starved(q, true);
             return 0;
         }
     }
 
     virtio_queue_set_notification(q->rx_vq, 0);
+    virtio_net_set_rx_starved(q, false);
     return 1;
 }
 
@@ -1814,6 +1878,62 @@ static void virtio_set_packet_hash(const uint8_t *buf, uint8_t report,
     hdr->hash_report = report;
 }
 
+/* Remember the queue the guest sent a flow on, so replies land there too */
+static void virtio_net_tx_flow_learn(VirtIONetQueue *q,
+                                     VirtQueueElement *elem)
+{
+    VirtIONet *n = q->n;
+    uint8_t buf[128];
+    struct iovec iov = { .iov_base = buf };
+    eth_ip6_hdr_info ip6;
+    eth_ip4_hdr_info ip4;
+    eth_l4_hdr_info l4;
+    size_t l3hdr_off, l4hdr_off, l5hdr_off;
+    bool hasip4, hasip6;
+    struct EBPFRSSFlowKey key;
+    uint16_t queue = q - n->vqs;
+
+    if (!n->flows || !n->rss_data.enabled || !n->rss_data.redirect) {
+        return;
+    }
+
+    iov.iov_len = iov_to_buf(elem->out_sg, elem->out_num, n->guest_hdr_len,
+                             buf, sizeof(buf));
+    eth_get_protocols(&iov, 1, &hasip4, &hasip6, &l3hdr_off, &l4hdr_off,
+                      &l5hdr_off, &ip6, &ip4, &l4);
+    if (!virtio_net_flow_key(hasip4, hasip6, &ip4, &ip6, &l4, true, &key)) {
+        return;
+    }
+
+    /* The eBPF flow map is an LRU map, evicted flows age out of it too */
+    if (virtio_net_flow_learn(n->flows, &key, queue)) {
+        ebpf_rss_set_flow(&n->ebpf_rss, &key, queue);
+    }
+}
+
+static bool virtio_net_flow_steer(VirtIONet *n, struct NetRxPkt *pkt,
+                                  bool hasip4, bool hasip6,
+                                  unsigned int *queue)
+{
+    struct EBPFRSSFlowKey key;
+    uint16_t flow_queue;
+
+    if (!n->flows ||
+        !virtio_net_flow_key(hasip4, hasip6, net_rx_pkt_get_ip4_info(pkt),
+                             net_rx_pkt_get_ip6_info(pkt),
+                             net_rx_pkt_get_l4_info(pkt), false, &key)) {
+        return false;
+    }
+
+    if (!virtio_net_flow_lookup(n->flows, &key, &flow_queue) ||
+        flow_queue >= n->curr_queue_pairs) {
+        return false;
+    }
+
+    *queue = flow_queue;
+    return true;
+}
+
 static int virtio_net_process_rss(NetClientState *nc, const uint8_t *buf,
                                   size_t size)
 {
@@ -1854,9 +1974,22 @@ static int virtio_net_process_rss(NetClientState *nc, const uint8_t *buf,
         virtio_set_packet_hash(buf, reports[net_hash_type], hash);
     }
 
-    if (n->rss_data.redirect) {
-        new_index = hash & (n->rss_data.indirections_len - 1);
-        new_index = n->rss_data.indirections_table[new_index];
+    if (n->rss_data.redirect &&
+        !virtio_net_flow_steer(n, pkt, hasip4, hasip6, &new_index)) {
+        uint16_t len = n->rss_data.indirections_len;
+
+        new_index = n->rss_data.indirections_table[hash & (len - 1)];
+
+        /* as in the eBPF program, try a second queue if this one is full */
+        if (n->flows && new_index < n->max_queue_pairs &&
+            n->vqs[new_index].rx_starved) {
+            unsigned int alt;
+
+            alt = n->rss_data.indirections_table[(hash >> 16) & (len - 1)];
+            if (alt < n->max_queue_pairs && !n->vqs[alt].rx_starved) {
+                new_index = alt;
+            }
+        }
     }
 
     return (index == new_index) ? -1 : new_index;
@@ -1987,10 +2120,16 @@ static ssize_t virtio_net_receive_rcu(NetClientState *nc, const uint8_t *buf,
 
     for (j = 0; j < i; j++) {
         /* signal other side */
-        virtqueue_fill(q->rx_vq, elems[j], lens[j], j);
+        virtqueue_fill(q->rx_vq, elems[j], lens[j], q->rx_batch_pending + j);
         g_free(elems[j]);
     }
 
+    if (q->rx_batching) {
+        /* virtio_net_receive_batch() flushes and notifies once at the end */
+        q->rx_batch_pending += i;
+        return size;
+    }
+
     virtqueue_flush(q->rx_vq, i);
     virtio_notify(vdev, q->rx_vq);
 
@@ -2617,6 +2756,99 @@ static ssize_t virtio_net_receive(NetClientState *nc, const uint8_t *buf,
     }
 }
 
+/*
+ * Userspace GRO for batched receive, see net/gro.c.  It needs a vnet
+ * header from the peer to know that the segments were validated, and
+ * mergeable buffers to hold the merged packet.
+ */
+static bool virtio_net_gro_enabled(VirtIONet *n)
+{
+    return n->rx_gro && n->has_vnet_hdr && n->mergeable_rx_bufs &&
+           (n->curr_guest_offloads & (1ULL << VIRTIO_NET_F_GUEST_CSUM)) &&
+           (n->curr_guest_offloads & ((1ULL << VIRTIO_NET_F_GUEST_TSO4) |
+                                      (1ULL << VIRTIO_NET_F_GUEST_TSO6)));
+}
+
+static int virtio_net_gro_merge(VirtIONet *n, const struct iovec *pkts,
+                                int count, size_t *size)
+{
+    VirtIODevice *vdev = VIRTIO_DEVICE(n);
+    struct virtio_net_hdr *hdr;
+    int merged;
+
+    merged = net_gro_merge(pkts, count, n->host_hdr_len,
+                           n->curr_guest_offloads &
+                           (1ULL << VIRTIO_NET_F_GUEST_TSO4),
+                           n->curr_guest_offloads &
+                           (1ULL << VIRTIO_NET_F_GUEST_TSO6),
+                           n->rx_gro_buf, size);
+
+    /*
+     * receive_header() byte-swaps the header if needed, otherwise it must
+     * already be in guest byte order.
+     */
+    if (merged > 1 && !n->needs_vnet_hdr_swap) {
+        hdr = (struct virtio_net_hdr *)n->rx_gro_buf;
+        hdr->hdr_len = virtio_tswap16(vdev, hdr->hdr_len);
+        hdr->gso_size = virtio_tswap16(vdev, hdr->gso_size);
+    }
+
+    return merged;
+}
+
+static int virtio_net_receive_batch(NetClientState *nc,
+                                    const struct iovec *pkts, int count)
+{
+    VirtIONet *n = qemu_get_nic_opaque(nc);
+    VirtIONetQueue *q = virtio_net_get_subqueue(nc);
+    VirtIODevice *vdev = VIRTIO_DEVICE(n);
+    size_t gro_size;
+    ssize_t ret;
+    bool gro;
+    int i, merged;
+
+    if (n->rsc4_enabled || n->rsc6_enabled) {
+        for (i = 0; i < count; i++) {
+            if (virtio_net_rsc_receive(nc, pkts[i].iov_base,
+                                       pkts[i].iov_len) == 0) {
+                break;
+            }
+        }
+        return i;
+    }
+
+    RCU_READ_LOCK_GUARD();
+
+    gro = virtio_net_gro_enabled(n);
+    if (gro && !n->rx_gro_buf) {
+        n->rx_gro_buf = g_malloc(
+            NET_GRO_BUF_SIZE(sizeof(struct virtio_net_hdr_v1_hash)));
+    }
+    q->rx_batching = true;
+    for (i = 0; i < count; i += merged) {
+        merged = gro ? virtio_net_gro_merge(n, &pkts[i], count - i,
+                                            &gro_size) : 1;
+        if (merged > 1) {
+            ret = virtio_net_receive_rcu(nc, n->rx_gro_buf, gro_size, false);
+        } else {
+            ret = virtio_net_receive_rcu(nc, pkts[i].iov_base,
+                                         pkts[i].iov_len, false);
+        }
+        if (ret == 0) {
+            break;
+        }
+    }
+    q->rx_batching = false;
+
+    if (q->rx_batch_pending) {
+        virtqueue_flush(q->rx_vq, q->rx_batch_pending);
+        q->rx_batch_pending = 0;
+        virtio_notify(vdev, q->rx_vq);
+    }
+
+    return i;
+}
+
 static int32_t virtio_net_flush_tx(VirtIONetQueue *q);
 
 static void virtio_net_tx_complete(NetClientState *nc, ssize_t len)
@@ -2652,11 +2884,222 @@ static void virtio_net_tx_complete(NetClientState *nc, ssize_t len)
 }
 
 /* TX */
+
+/* Number of packets taken off the TX virtqueue at a time */
+#define VIRTIO_NET_TX_POP_BATCH 16
+
+/* Hand back popped but unprocessed elements, most recent first */
+static void virtio_net_tx_unpop(VirtIONetQueue *q, VirtQueueElement **elems,
+                                unsigned int num)
+{
+    while (num--) {
+        virtqueue_unpop(q->tx_vq, elems[num], 0);
+        g_free(elems[num]);
+    }
+}
+
+/*
+ * Software segmentation and checksumming of guest packets whose offloads
+ * the peer cannot handle.  Segments are copied back to back into
+ * n->tx_sw_gso_buf and handed to the peer in batches; a segment that is
+ * larger than the buffer is sent on its own.  If the peer does not take
+ * all of them, the element stays in q->async_tx until the net layer has
+ * sent the last queued segment.
+ */
+#define VIRTIO_NET_SW_GSO_BATCH     64
+#define VIRTIO_NET_SW_GSO_BUF_SIZE  (2 * NET_BUFSIZE)
+
+typedef struct VirtIONetSwGso {
+    VirtIONet *n;
+    VirtIONetQueue *q;
+    NetClientState *nc;
+    size_t used;
+    int count;
+    struct iovec pkts[VIRTIO_NET_SW_GSO_BATCH];
+} VirtIONetSwGso;
+
+static void virtio_net_sw_gso_sent(NetClientState *nc, ssize_t len)
+{
+    VirtIONetQueue *q = virtio_net_get_subqueue(nc);
+
+    assert(q->async_tx.sw_gso_pending);
+    if (--q->async_tx.sw_gso_pending == 0) {
+        virtio_net_tx_complete(nc, len);
+    }
+}
+
+static void virtio_net_sw_gso_flush(VirtIONetSwGso *gso)
+{
+    int done;
+
+    /* Segments that the peer cannot take right now are queued (copied) */
+    if (gso->count) {
+        done = qemu_send_packets_async(gso->nc, gso->pkts, gso->count,
+                                       virtio_net_sw_gso_sent);
+        gso->q->async_tx.sw_gso_pending += gso->count - done;
+    }
+    gso->used = 0;
+    gso->count = 0;
+}
+
+/* Build the vnet header of a segment for the peer in @buf */
+static void virtio_net_sw_gso_hdr(VirtIONet *n, const struct iovec *virt_iov,
+                                  uint8_t *buf)
+{
+    /* the segment header only has flags, which need no byte swap */
+    memset(buf, 0, n->host_hdr_len);
+    iov_to_buf(virt_iov, 1, 0, buf,
+               MIN(n->host_hdr_len, sizeof(struct virtio_net_hdr)));
+}
+
+/* Send a segment that does not fit in the staging buffer on its own */
+static void virtio_net_sw_gso_send_large(VirtIONetSwGso *gso,
+                                         const struct iovec *iov, int iov_cnt,
+                                         const struct iovec *virt_iov)
+{
+    VirtIONet *n = gso->n;
+    uint8_t hdr[sizeof(struct virtio_net_hdr_v1_hash)];
+    g_autofree struct iovec *sg = g_new(struct iovec, iov_cnt + 1);
+
+    virtio_net_sw_gso_hdr(n, virt_iov, hdr);
+    sg[0].iov_base = hdr;
+    sg[0].iov_len = n->host_hdr_len;
+    memcpy(sg + 1, iov, iov_cnt * sizeof(*iov));
+
+    /* A queued packet is copied, so hdr may go out of scope */
+    if (!qemu_sendv_packet_async(gso->nc, sg, iov_cnt + 1,
+                                 virtio_net_sw_gso_sent)) {
+        gso->q->async_tx.sw_gso_pending++;
+    }
+}
+
+static void virtio_net_sw_gso_send(void *opaque,
+                                   const struct iovec *iov, int iov_cnt,
+                                   const struct iovec *virt_iov,
+                                   int virt_iov_cnt)
+{
+    VirtIONetSwGso *gso = opaque;
+    VirtIONet *n = gso->n;
+    size_t len = n->host_hdr_len + iov_size(iov, iov_cnt);
+    uint8_t *buf;
+
+    if (gso->count == VIRTIO_NET_SW_GSO_BATCH ||
+        gso->used + len > VIRTIO_NET_SW_GSO_BUF_SIZE) {
+        virtio_net_sw_gso_flush(gso);
+    }
+    if (len > VIRTIO_NET_SW_GSO_BUF_SIZE) {
+        virtio_net_sw_gso_send_large(gso, iov, iov_cnt, virt_iov);
+        return;
+    }
+
+    buf = n->tx_sw_gso_buf + gso->used;
+    if (n->host_hdr_len) {
+        virtio_net_sw_gso_hdr(n, virt_iov, buf);
+    }
+    iov_to_buf(iov, iov_cnt, 0, buf + n->host_hdr_len,
+               len - n->host_hdr_len);
+
+    gso->pkts[gso->count].iov_base = buf;
+    gso->pkts[gso->count].iov_len = len;
+    gso->count++;
+    gso->used += len;
+}
+
+/*
+ * Do the offloads requested by the guest header in @elem if the peer
+ * cannot.  Returns false if the packet should be passed to the peer as
+ * is; otherwise the packet has been sent, queued or dropped.  If it was
+ * queued, q->async_tx.sw_gso_pending is non-zero.
+ */
+static bool virtio_net_tx_sw_offload(VirtIONetQueue *q, VirtQueueElement *elem)
+{
+    VirtIONet *n = q->n;
+    VirtIODevice *vdev = VIRTIO_DEVICE(n);
+    int queue_index = vq2q(virtio_get_queue_index(q->tx_vq));
+    struct NetTxPkt *pkt = n->tx_pkt;
+    struct iovec sg[VIRTQUEUE_MAX_SIZE];
+    struct virtio_net_hdr hdr;
+    VirtIONetSwGso gso = {
+        .n = n,
+        .q = q,
+        .nc = qemu_get_subqueue(n->nic, queue_index),
+    };
+    unsigned int sg_num, i;
+    uint16_t gso_size;
+    uint8_t gso_type;
+    bool ok;
+
+    if (!pkt || iov_to_buf(elem->out_sg, elem->out_num, 0, &hdr,
+                           sizeof(hdr)) < sizeof(hdr)) {
+        return false;
+    }
+
+    gso_type = hdr.gso_type & ~VIRTIO_NET_HDR_GSO_ECN;
+    if (gso_type != VIRTIO_NET_HDR_GSO_UDP_L4 &&
+        !(gso_type == VIRTIO_NET_HDR_GSO_UDP && !peer_has_ufo(n)) &&
+        (n->has_vnet_hdr || (gso_type == VIRTIO_NET_HDR_GSO_NONE &&
+                             !(hdr.flags & VIRTIO_NET_HDR_F_NEEDS_CSUM)))) {
+        return false;
+    }
+    gso_size = virtio_tswap16(vdev, hdr.gso_size);
+
+    net_tx_pkt_reset(pkt, NULL);
+    sg_num = iov_copy(sg, ARRAY_SIZE(sg), elem->out_sg, elem->out_num,
+                      n->guest_hdr_len, -1);
+    for (i = 0; i < sg_num; i++) {
+        if (!net_tx_pkt_add_raw_fragment_host(pkt, sg[i].iov_base,
+                                              sg[i].iov_len)) {
+            return true;
+        }
+    }
+    if (!net_tx_pkt_parse(pkt)) {
+        return true;
+    }
+
+    switch (gso_type) {
+    case VIRTIO_NET_HDR_GSO_NONE:
+        ok = net_tx_pkt_build_vheader(pkt, false, true, 0);
+        break;
+    case VIRTIO_NET_HDR_GSO_TCPV4:
+    case VIRTIO_NET_HDR_GSO_TCPV6:
+    case VIRTIO_NET_HDR_GSO_UDP:
+        /* the guest's hdr_len is only a hint, recompute the header */
+        ok = gso_size && net_tx_pkt_build_vheader(pkt, true, true, gso_size) &&
+             net_tx_pkt_get_vhdr(pkt)->gso_type == gso_type;
+        break;
+    case VIRTIO_NET_HDR_GSO_UDP_L4:
+        ok = net_tx_pkt_build_vheader_uso(pkt, gso_size);
+        break;
+    default:
+        ok = false;
+        break;
+    }
+
+    if (ok) {
+        if (!n->tx_sw_gso_buf) {
+            n->tx_sw_gso_buf = g_malloc(VIRTIO_NET_SW_GSO_BUF_SIZE);
+        }
+        /*
+         * Hold one count while sending, so that virtio_net_sw_gso_sent()
+         * does not complete the element before it is in q->async_tx.
+         */
+        q->async_tx.sw_gso_pending = 1;
+        net_tx_pkt_send_custom(pkt, false, virtio_net_sw_gso_send, &gso);
+        virtio_net_sw_gso_flush(&gso);
+        q->async_tx.sw_gso_pending--;
+    }
+    net_tx_pkt_reset(pkt, NULL);
+
+    return true;
+}
+
 static int32_t virtio_net_flush_tx(VirtIONetQueue *q)
 {
     VirtIONet *n = q->n;
     VirtIODevice *vdev = VIRTIO_DEVICE(n);
     VirtQueueElement *elem;
+    VirtQueueElement *elems[VIRTIO_NET_TX_POP_BATCH];
+    unsigned int next_elem = 0, num_elems = 0;
     int32_t num_packets = 0;
     int queue_index = vq2q(virtio_get_queue_index(q->tx_vq));
     if (!(vdev->status & VIRTIO_CONFIG_S_DRIVER_OK)) {
@@ -2674,24 +3117,47 @@ static int32_t virtio_net_flush_tx(VirtIONetQueue *q)
         struct iovec sg[VIRTQUEUE_MAX_SIZE], sg2[VIRTQUEUE_MAX_SIZE + 1], *out_sg;
         struct virtio_net_hdr_mrg_rxbuf mhdr;
 
-        elem = virtqueue_pop(q->tx_vq, sizeof(VirtQueueElement));
-        if (!elem) {
-            break;
+        if (next_elem == num_elems) {
+            num_elems = virtqueue_pop_batch(q->tx_vq, sizeof(VirtQueueElement),
+                                            (void **)elems,
+                                            MIN(ARRAY_SIZE(elems),
+                                                n->tx_burst - num_packets));
+            next_elem = 0;
+            if (!num_elems) {
+                break;
+            }
         }
+        elem = elems[next_elem++];
 
         out_num = elem->out_num;
         out_sg = elem->out_sg;
         if (out_num < 1) {
             virtio_error(vdev, "virtio-net header not in first element");
+            virtio_net_tx_unpop(q, elems + next_elem, num_elems - next_elem);
             virtqueue_detach_element(q->tx_vq, elem, 0);
             g_free(elem);
             return -EINVAL;
         }
 
+        virtio_net_tx_flow_learn(q, elem);
+
+        if (virtio_net_tx_sw_offload(q, elem)) {
+            if (!q->async_tx.sw_gso_pending) {
+                goto drop;
+            }
+            /* Completed by virtio_net_sw_gso_sent() */
+            virtio_net_tx_unpop(q, elems + next_elem, num_elems - next_elem);
+            virtio_queue_set_notification(q->tx_vq, 0);
+            q->async_tx.elem = elem;
+            return -EBUSY;
+        }
+
         if (n->has_vnet_hdr) {
             if (iov_to_buf(out_sg, out_num, 0, &mhdr, n->guest_hdr_len) <
                 n->guest_hdr_len) {
                 virtio_error(vdev, "virtio-net header incorrect");
+                virtio_net_tx_unpop(q, elems + next_elem,
+                                    num_elems - next_elem);
                 virtqueue_detach_element(q->tx_vq, elem, 0);
                 g_free(elem);
                 return -EINVAL;
@@ -2730,6 +3196,7 @@ static int32_t virtio_net_flush_tx(VirtIONetQueue *q)
         ret = qemu_sendv_packet_async(qemu_get_subqueue(n->nic, queue_index),
                                       out_sg, out_num, virtio_net_tx_complete);
         if (ret == 0) {
+            virtio_net_tx_unpop(q, elems + next_elem, num_elems - next_elem);
             virtio_queue_set_notification(q->tx_vq, 0);
             q->async_tx.elem = elem;
             return -EBUSY;
@@ -2920,6 +3387,15 @@ static void virtio_net_add_queue(VirtIONet *n, int index)
         n->vqs[index].tx_bh = qemu_bh_new(virtio_net_tx_bh, &n->vqs[index]);
     }
 
+    virtio_queue_set_notification_coalescing(n->vqs[index].rx_vq,
+                                             n->net_conf.rx_coalesce_usecs,
+                                             n->net_conf.rx_coalesce_max_frames,
+                                             n->net_conf.rx_coalesce_adaptive);
+    virtio_queue_set_notification_coalescing(n->vqs[index].tx_vq,
+                                             n->net_conf.tx_coalesce_usecs,
+                                             n->net_conf.tx_coalesce_max_frames,
+                                             n->net_conf.tx_coalesce_adaptive);
+
     n->vqs[index].tx_waiting = 0;
     n->vqs[index].n = n;
 }
@@ -3052,7 +3528,7 @@ static int virtio_net_post_load_device(void *opaque, int version_id)
     if (n->rss_data.enabled) {
         n->rss_data.enabled_software_rss = n->rss_data.populate_hash;
         if (!n->rss_data.populate_hash) {
-            if (!virtio_net_attach_epbf_rss(n)) {
+            if (!virtio_net_attach_epbf_rss(n, n->curr_queue_pairs)) {
                 if (get_vhost_net(qemu_get_queue(n->nic)->peer)) {
                     warn_report("Can't post-load eBPF RSS for vhost");
                 } else {
@@ -3333,6 +3809,7 @@ static NetClientInfo net_virtio_info = {
     .size = sizeof(NICState),
     .can_receive = virtio_net_can_receive,
     .receive = virtio_net_receive,
+    .receive_batch = virtio_net_receive_batch,
     .link_status_changed = virtio_net_set_link_status,
     .query_rx_filter = virtio_net_query_rxfilter,
     .announce = virtio_net_announce,
@@ -3736,6 +4213,12 @@ static void virtio_net_device_realize(DeviceState *dev, Error **errp)
     n->qdev = dev;
 
     net_rx_pkt_init(&n->rx_pkt);
+    if (n->flow_steering) {
+        n->flows = virtio_net_flow_table_new();
+    }
+    if (n->sw_gso) {
+        net_tx_pkt_init(&n->tx_pkt, NULL, VIRTQUEUE_MAX_SIZE);
+    }
 
     if (virtio_has_feature(n->host_features, VIRTIO_NET_F_RSS)) {
         virtio_net_load_ebpf(n);
@@ -3762,6 +4245,7 @@ static void virtio_net_device_unrealize(DeviceState *dev)
 
     g_free(n->mac_table.macs);
     g_free(n->vlans);
+    g_free(n->rx_gro_buf);
 
     if (n->failover) {
         qobject_unref(n->primary_opts);
@@ -3783,6 +4267,9 @@ static void virtio_net_device_unrealize(DeviceState *dev)
     virtio_net_rsc_cleanup(n);
     g_free(n->rss_data.indirections_table);
     net_rx_pkt_uninit(n->rx_pkt);
+    net_tx_pkt_uninit(n->tx_pkt);
+    g_free(n->tx_sw_gso_buf);
+    virtio_net_flow_table_free(n->flows);
     virtio_cleanup(vdev);
 }
 
@@ -3879,6 +4366,8 @@ static Property virtio_net_properties[] = {
                     VIRTIO_NET_F_HOST_ECN, true),
     DEFINE_PROP_BIT64("host_ufo", VirtIONet, host_features,
                     VIRTIO_NET_F_HOST_UFO, true),
+    DEFINE_PROP_BIT64("host_uso", VirtIONet, host_features,
+                    VIRTIO_NET_F_HOST_USO, false),
     DEFINE_PROP_BIT64("mrg_rxbuf", VirtIONet, host_features,
                     VIRTIO_NET_F_MRG_RXBUF, true),
     DEFINE_PROP_BIT64("status", VirtIONet, host_features,
@@ -3913,12 +4402,27 @@ static Property virtio_net_properties[] = {
                        VIRTIO_NET_RX_QUEUE_DEFAULT_SIZE),
     DEFINE_PROP_UINT16("tx_queue_size", VirtIONet, net_conf.tx_queue_size,
                        VIRTIO_NET_TX_QUEUE_DEFAULT_SIZE),
+    DEFINE_PROP_UINT32("rx_coalesce_usecs", VirtIONet,
+                       net_conf.rx_coalesce_usecs, 0),
+    DEFINE_PROP_UINT32("rx_coalesce_max_frames", VirtIONet,
+                       net_conf.rx_coalesce_max_frames, 0),
+    DEFINE_PROP_UINT32("tx_coalesce_usecs", VirtIONet,
+                       net_conf.tx_coalesce_usecs, 0),
+    DEFINE_PROP_UINT32("tx_coalesce_max_frames", VirtIONet,
+                       net_conf.tx_coalesce_max_frames, 0),
+    DEFINE_PROP_BOOL("rx_coalesce_adaptive", VirtIONet,
+                     net_conf.rx_coalesce_adaptive, false),
+    DEFINE_PROP_BOOL("tx_coalesce_adaptive", VirtIONet,
+                     net_conf.tx_coalesce_adaptive, false),
     DEFINE_PROP_UINT16("host_mtu", VirtIONet, net_conf.mtu, 0),
     DEFINE_PROP_BOOL("x-mtu-bypass-backend", VirtIONet, mtu_bypass_backend,
                      true),
     DEFINE_PROP_INT32("speed", VirtIONet, net_conf.speed, SPEED_UNKNOWN),
     DEFINE_PROP_STRING("duplex", VirtIONet, net_conf.duplex_str),
     DEFINE_PROP_BOOL("failover", VirtIONet, failover, false),
+    DEFINE_PROP_BOOL("x-rx-gro", VirtIONet, rx_gro, true),
+    DEFINE_PROP_BOOL("x-sw-gso", VirtIONet, sw_gso, false),
+    DEFINE_PROP_BOOL("x-flow-steering", VirtIONet, flow_steering, false),
     DEFINE_PROP_END_OF_LIST(),
 };
 
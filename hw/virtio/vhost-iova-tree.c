@@ -28,6 +28,12 @@ struct VhostIOVATree {
 
     /* IOVA address to qemu memory maps. */
     IOVATree *iova_taddr_map;
+
+    /*
+     * Last map found by vhost_iova_tree_find_iova.  Guest RAM is usually
+     * a few large maps, so most lookups hit it and skip the tree walk.
+     */
+    const DMAMap *last_found;
 };
 
 /**
@@ -44,6 +50,7 @@ VhostIOVATree *vhost_iova_tree_new(hwaddr iova_first, hwaddr iova_last)
     tree->iova_last = iova_last;
 
     tree->iova_taddr_map = iova_tree_new();
+    tree->last_found = NULL;
     return tree;
 }
 
@@ -56,6 +63,15 @@ void vhost_iova_tree_delete(VhostIOVATree *iova_tree)
     g_free(iova_tree);
 }
 
+static bool vhost_iova_tree_map_contains(const DMAMap *map,
+                                         const DMAMap *needle)
+{
+    return needle->translated_addr >= map->translated_addr &&
+           needle->size <= map->size &&
+           needle->translated_addr - map->translated_addr <=
+           map->size - needle->size;
+}
+
 /**
  * Find the IOVA address stored from a memory address
  *
@@ -64,10 +80,21 @@ void vhost_iova_tree_delete(VhostIOVATree *iova_tree)
  *
  * Return the stored mapping, or NULL if not found.
  */
-const DMAMap *vhost_iova_tree_find_iova(const VhostIOVATree *tree,
+const DMAMap *vhost_iova_tree_find_iova(VhostIOVATree *tree,
                                         const DMAMap *map)
 {
-    return iova_tree_find_iova(tree->iova_taddr_map, map);
+    const DMAMap *result;
+
+    if (tree->last_found &&
+        vhost_iova_tree_map_contains(tree->last_found, map)) {
+        return tree->last_found;
+    }
+
+    result = iova_tree_find_iova(tree->iova_taddr_map, map);
+    if (result) {
+        tree->last_found = result;
+    }
+    return result;
 }
 
 /**
@@ -106,5 +133,6 @@ int vhost_iova_tree_map_alloc(VhostIOVATree *tree, DMAMap *map)
  */
 void vhost_iova_tree_remove(VhostIOVATree *iova_tree, DMAMap map)
 {
+    iova_tree->last_found = NULL;
     iova_tree_remove(iova_tree->iova_taddr_map, map);
 }
@@ -15,7 +15,25 @@
 #include "qemu/main-loop.h"
 #include "qemu/log.h"
 #include "qemu/memalign.h"
+#include "qemu/module.h"
+#include "sysemu/stats.h"
 #include "linux-headers/linux/vhost.h"
+#include "trace.h"
+
+/* Guest buffers popped and made available to the device per kick */
+#define VHOST_SVQ_BATCH 32
+
+#define AVAIL_BUFFERS_STR       "avail-buffers"
+#define AVAIL_BATCHES_STR       "avail-batches"
+#define KICKS_STR               "kicks"
+#define KICKS_SUPPRESSED_STR    "kicks-suppressed"
+#define USED_BUFFERS_STR        "used-buffers"
+#define CALLS_STR               "calls"
+#define CALLS_SUPPRESSED_STR    "calls-suppressed"
+
+/* Running SVQs, protected by the BQL like their counters */
+static QLIST_HEAD(, VhostShadowVirtqueue) vhost_svqs =
+    QLIST_HEAD_INITIALIZER(vhost_svqs);
 
 /**
  * Validate the transport device features that both guests can use with the SVQ
@@ -204,23 +222,37 @@ static bool vhost_svq_add_split(VhostShadowVirtqueue *svq,
 
     /*
      * Put the entry in the available array (but don't update avail->idx until
-     * they do sync).
+     * the device is kicked).
      */
     avail_idx = svq->shadow_avail_idx & (svq->vring.num - 1);
     avail->ring[avail_idx] = cpu_to_le16(*head);
     svq->shadow_avail_idx++;
-
-    /* Update the avail index after write the descriptor */
-    smp_wmb();
-    avail->idx = cpu_to_le16(svq->shadow_avail_idx);
+    svq->num_added++;
 
     return true;
 }
 
+/**
+ * Expose the heads added since the last kick to the device, and kick it
+ * unless it suppressed notifications for all of them.
+ *
+ * @svq: The svq
+ */
 static void vhost_svq_kick(VhostShadowVirtqueue *svq)
 {
+    uint16_t new = svq->shadow_avail_idx;
+    uint16_t old = new - svq->num_added;
     bool needs_kick;
 
+    if (!svq->num_added) {
+        return;
+    }
+    svq->num_added = 0;
+
+    /* Update the avail index after write the descriptors */
+    smp_wmb();
+    svq->vring.avail->idx = cpu_to_le16(new);
+
     /*
      * We need to expose the available array entries before checking the used
      * flags
@@ -228,27 +260,30 @@ static void vhost_svq_kick(VhostShadowVirtqueue *svq)
     smp_mb();
 
     if (virtio_vdev_has_feature(svq->vdev, VIRTIO_RING_F_EVENT_IDX)) {
-        uint16_t avail_event = *(uint16_t *)(&svq->vring.used->ring[svq->vring.num]);
-        needs_kick = vring_need_event(avail_event, svq->shadow_avail_idx, svq->shadow_avail_idx - 1);
+        uint16_t *avail_event = (uint16_t *)
+                                &svq->vring.used->ring[svq->vring.num];
+        needs_kick = vring_need_event(le16_to_cpu(*avail_event), new, old);
     } else {
         needs_kick = !(svq->vring.used->flags & VRING_USED_F_NO_NOTIFY);
     }
 
     if (!needs_kick) {
+        svq->stats.kicks_suppressed++;
         return;
     }
 
+    svq->stats.kicks++;
     event_notifier_set(&svq->hdev_kick);
 }
 
-/**
- * Add an element to a SVQ.
- *
- * Return -EINVAL if element is invalid, -ENOSPC if dev queue is full
+/*
+ * Add an element to the SVQ without kicking the device.  Return -EINVAL if
+ * element is invalid, -ENOSPC if dev queue is full
  */
-int vhost_svq_add(VhostShadowVirtqueue *svq, const struct iovec *out_sg,
-                  size_t out_num, const struct iovec *in_sg, size_t in_num,
-                  VirtQueueElement *elem)
+static int vhost_svq_add_no_kick(VhostShadowVirtqueue *svq,
+                                 const struct iovec *out_sg, size_t out_num,
+                                 const struct iovec *in_sg, size_t in_num,
+                                 VirtQueueElement *elem)
 {
     unsigned qemu_head;
     unsigned ndescs = in_num + out_num;
@@ -265,16 +300,36 @@ int vhost_svq_add(VhostShadowVirtqueue *svq, const struct iovec *out_sg,
 
     svq->desc_state[qemu_head].elem = elem;
     svq->desc_state[qemu_head].ndescs = ndescs;
-    vhost_svq_kick(svq);
+    svq->stats.avail_elems++;
     return 0;
 }
 
-/* Convenience wrapper to add a guest's element to SVQ */
+/**
+ * Add an element to a SVQ.
+ *
+ * Return -EINVAL if element is invalid, -ENOSPC if dev queue is full
+ */
+int vhost_svq_add(VhostShadowVirtqueue *svq, const struct iovec *out_sg,
+                  size_t out_num, const struct iovec *in_sg, size_t in_num,
+                  VirtQueueElement *elem)
+{
+    int r = vhost_svq_add_no_kick(svq, out_sg, out_num, in_sg, in_num, elem);
+
+    if (r == 0) {
+        vhost_svq_kick(svq);
+    }
+    return r;
+}
+
+/*
+ * Convenience wrapper to add a guest's element to SVQ.  The caller kicks
+ * the device once for the whole batch.
+ */
 static int vhost_svq_add_element(VhostShadowVirtqueue *svq,
                                  VirtQueueElement *elem)
 {
-    return vhost_svq_add(svq, elem->out_sg, elem->out_num, elem->in_sg,
-                         elem->in_num, elem);
+    return vhost_svq_add_no_kick(svq, elem->out_sg, elem->out_num,
+                                 elem->in_sg, elem->in_num, elem);
 }
 
 /**
@@ -295,30 +350,50 @@ static void vhost_handle_guest_kick(VhostShadowVirtqueue *svq)
     /* Clear event notifier */
     event_notifier_test_and_clear(&svq->svq_kick);
 
-    /* Forward to the device as many available buffers as possible */
+    /*
+     * Forward to the device as many available buffers as possible, popping
+     * them in batches and kicking the device once per batch.
+     */
     do {
         virtio_queue_set_notification(svq->vq, false);
 
         while (true) {
-            g_autofree VirtQueueElement *elem = NULL;
-            int r;
+            VirtQueueElement *elems[VHOST_SVQ_BATCH];
+            unsigned int n = 0, i;
+            int r = 0;
 
             if (svq->next_guest_avail_elem) {
-                elem = g_steal_pointer(&svq->next_guest_avail_elem);
-            } else {
-                elem = virtqueue_pop(svq->vq, sizeof(*elem));
+                elems[n++] = g_steal_pointer(&svq->next_guest_avail_elem);
             }
-
-            if (!elem) {
+            n += virtqueue_pop_batch(svq->vq, sizeof(VirtQueueElement),
+                                     (void **)elems + n,
+                                     ARRAY_SIZE(elems) - n);
+            if (!n) {
                 break;
             }
 
-            if (svq->ops) {
-                r = svq->ops->avail_handler(svq, elem, svq->ops_opaque);
-            } else {
-                r = vhost_svq_add_element(svq, elem);
+            for (i = 0; i < n; i++) {
+                if (svq->ops) {
+                    r = svq->ops->avail_handler(svq, elems[i],
+                                                svq->ops_opaque);
+                } else {
+                    r = vhost_svq_add_element(svq, elems[i]);
+                }
+                if (unlikely(r != 0)) {
+                    break;
+                }
             }
+
+            vhost_svq_kick(svq);
+            svq->stats.avail_batches++;
+
             if (unlikely(r != 0)) {
+                /* Give back the buffers after the failed one */
+                for (unsigned int j = n; j-- > i + 1; ) {
+                    virtqueue_unpop(svq->vq, elems[j], 0);
+                    g_free(elems[j]);
+                }
+
                 if (r == -ENOSPC) {
                     /*
                      * This condition is possible since a contiguous buffer in
@@ -331,14 +406,15 @@ static void vhost_handle_guest_kick(VhostShadowVirtqueue *svq)
                      * queue the current guest descriptor and ignore kicks
                      * until some elements are used.
                      */
-                    svq->next_guest_avail_elem = g_steal_pointer(&elem);
+                    svq->next_guest_avail_elem = elems[i];
+                } else {
+                    g_free(elems[i]);
                 }
 
                 /* VQ is full or broken, just return and ignore kicks */
                 return;
             }
-            /* elem belongs to SVQ or external caller now */
-            elem = NULL;
+            /* elems belong to SVQ or external caller now */
         }
 
         virtio_queue_set_notification(svq->vq, true);
@@ -498,8 +574,18 @@ static void vhost_svq_flush(VhostShadowVirtqueue *svq,
             virtqueue_fill(vq, elem, len, i++);
         }
 
-        virtqueue_flush(vq, i);
-        event_notifier_set(&svq->svq_call);
+        if (i) {
+            virtqueue_flush(vq, i);
+            svq->stats.used_elems += i;
+
+            /* Honour the guest's interrupt suppression, as virtio_notify */
+            if (virtio_queue_should_notify(svq->vdev, vq)) {
+                svq->stats.calls++;
+                event_notifier_set(&svq->svq_call);
+            } else {
+                svq->stats.calls_suppressed++;
+            }
+        }
 
         if (check_for_avail_queue && svq->next_guest_avail_elem) {
             /*
@@ -654,11 +740,16 @@ void vhost_svq_start(VhostShadowVirtqueue *svq, VirtIODevice *vdev,
     svq->shadow_avail_idx = 0;
     svq->shadow_used_idx = 0;
     svq->last_used_idx = 0;
+    svq->num_added = 0;
+    memset(&svq->stats, 0, sizeof(svq->stats));
     svq->vdev = vdev;
     svq->vq = vq;
     svq->iova_tree = iova_tree;
+    QLIST_INSERT_HEAD(&vhost_svqs, svq, next);
 
     svq->vring.num = virtio_queue_get_num(vdev, virtio_get_queue_index(vq));
+    /* Calls to the guest are decided from here on by vhost_svq_flush */
+    virtio_queue_invalidate_signalled_used(vdev, virtio_get_queue_index(vq));
     driver_size = vhost_svq_driver_area_size(svq);
     device_size = vhost_svq_device_area_size(svq);
     svq->vring.desc = qemu_memalign(qemu_real_host_page_size(), driver_size);
@@ -690,6 +781,12 @@ void vhost_svq_stop(VhostShadowVirtqueue *svq)
     /* Send all pending used descriptors to guest */
     vhost_svq_flush(svq, false);
 
+    trace_vhost_svq_stats(svq, svq->stats.avail_elems,
+                          svq->stats.avail_batches, svq->stats.kicks,
+                          svq->stats.kicks_suppressed, svq->stats.used_elems,
+                          svq->stats.calls, svq->stats.calls_suppressed);
+    QLIST_REMOVE(svq, next);
+
     for (unsigned i = 0; i < svq->vring.num; ++i) {
         g_autofree VirtQueueElement *elem = NULL;
         elem = g_steal_pointer(&svq->desc_state[i].elem);
@@ -743,3 +840,98 @@ void vhost_svq_free(gpointer pvq)
     vhost_svq_stop(vq);
     g_free(vq);
 }
+
+static StatsList *vhost_svq_stats_add(const char *name, uint64_t val,
+                                      strList *names, StatsList *stats_list)
+{
+    if (apply_str_list_filter(name, names)) {
+        stats_list = stats_add_scalar(name, val, stats_list);
+    }
+    return stats_list;
+}
+
+/* One entry per device, with the counters of its running SVQs summed up */
+static void vhost_svq_stats_cb(StatsResultList **result, StatsTarget target,
+                               strList *names, strList *targets,
+                               Error **errp)
+{
+    g_autoptr(GHashTable) devs = NULL;
+    VhostShadowVirtqueueStats *sum;
+    VhostShadowVirtqueue *svq;
+    GHashTableIter iter;
+    gpointer vdev;
+
+    if (target != STATS_TARGET_VM) {
+        return;
+    }
+
+    devs = g_hash_table_new_full(NULL, NULL, NULL, g_free);
+    QLIST_FOREACH(svq, &vhost_svqs, next) {
+        sum = g_hash_table_lookup(devs, svq->vdev);
+        if (!sum) {
+            sum = g_new0(VhostShadowVirtqueueStats, 1);
+            g_hash_table_insert(devs, svq->vdev, sum);
+        }
+        sum->avail_elems += svq->stats.avail_elems;
+        sum->avail_batches += svq->stats.avail_batches;
+        sum->kicks += svq->stats.kicks;
+        sum->kicks_suppressed += svq->stats.kicks_suppressed;
+        sum->used_elems += svq->stats.used_elems;
+        sum->calls += svq->stats.calls;
+        sum->calls_suppressed += svq->stats.calls_suppressed;
+    }
+
+    g_hash_table_iter_init(&iter, devs);
+    while (g_hash_table_iter_next(&iter, &vdev, (gpointer *)&sum)) {
+        g_autofree char *qom_path = NULL;
+        StatsList *stats_list = NULL;
+
+        stats_list = vhost_svq_stats_add(CALLS_SUPPRESSED_STR,
+                                         sum->calls_suppressed, names,
+                                         stats_list);
+        stats_list = vhost_svq_stats_add(CALLS_STR, sum->calls, names,
+                                         stats_list);
+        stats_list = vhost_svq_stats_add(USED_BUFFERS_STR, sum->used_elems,
+                                         names, stats_list);
+        stats_list = vhost_svq_stats_add(KICKS_SUPPRESSED_STR,
+                                         sum->kicks_suppressed, names,
+                                         stats_list);
+        stats_list = vhost_svq_stats_add(KICKS_STR, sum->kicks, names,
+                                         stats_list);
+        stats_list = vhost_svq_stats_add(AVAIL_BATCHES_STR,
+                                         sum->avail_batches, names,
+                                         stats_list);
+        stats_list = vhost_svq_stats_add(AVAIL_BUFFERS_STR, sum->avail_elems,
+                                         names, stats_list);
+
+        if (stats_list) {
+            qom_path = object_get_canonical_path(OBJECT(vdev));
+            add_stats_entry(result, STATS_PROVIDER_VHOST_SVQ, qom_path,
+                            stats_list);
+        }
+    }
+}
+
+static void vhost_svq_schemas_cb(StatsSchemaList **result, Error **errp)
+{
+    StatsSchemaValueList *stats_list = NULL;
+    const char *names[] = { CALLS_SUPPRESSED_STR, CALLS_STR, USED_BUFFERS_STR,
+                            KICKS_SUPPRESSED_STR, KICKS_STR,
+                            AVAIL_BATCHES_STR, AVAIL_BUFFERS_STR };
+
+    for (int i = 0; i < ARRAY_SIZE(names); i++) {
+        stats_list = stats_schema_add(names[i], STATS_TYPE_CUMULATIVE,
+                                      stats_list);
+    }
+
+    add_stats_schema(result, STATS_PROVIDER_VHOST_SVQ, STATS_TARGET_VM,
+                     stats_list);
+}
+
+static void vhost_svq_stats_init(void)
+{
+    add_stats_callbacks(STATS_PROVIDER_VHOST_SVQ, vhost_svq_stats_cb,
+                        vhost_svq_schemas_cb);
+}
+
+type_init(vhost_svq_stats_init);
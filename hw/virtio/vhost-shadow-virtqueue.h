@@ -46,6 +46,27 @@ typedef struct VhostShadowVirtqueueOps {
     VirtQueueAvailCallback avail_handler;
 } VhostShadowVirtqueueOps;
 
+/*
+ * Forwarding counters, reset when the SVQ starts.  They are reported by
+ * query-stats while the SVQ runs.
+ */
+typedef struct VhostShadowVirtqueueStats {
+    /* Guest buffers made available to the device, and batches of them */
+    uint64_t avail_elems;
+    uint64_t avail_batches;
+
+    /* Device kicks sent, and skipped because the device did not ask */
+    uint64_t kicks;
+    uint64_t kicks_suppressed;
+
+    /* Used buffers returned to the guest */
+    uint64_t used_elems;
+
+    /* Guest calls sent, and skipped because the guest did not ask */
+    uint64_t calls;
+    uint64_t calls_suppressed;
+} VhostShadowVirtqueueStats;
+
 /* Shadow virtqueue to relay notifications */
 typedef struct VhostShadowVirtqueue {
     /* Shadow vring */
@@ -107,6 +128,14 @@ typedef struct VhostShadowVirtqueue {
 
     /* Next head to consume from the device */
     uint16_t last_used_idx;
+
+    /* Heads added to the avail ring since the device was last kicked */
+    uint16_t num_added;
+
+    VhostShadowVirtqueueStats stats;
+
+    /* Entry in the list of running SVQs */
+    QLIST_ENTRY(VhostShadowVirtqueue) next;
 } VhostShadowVirtqueue;
 
 bool vhost_svq_valid_features(uint64_t features, Error **errp);
@@ -29,6 +29,7 @@
 #include "hw/qdev-properties.h"
 #include "hw/virtio/virtio-access.h"
 #include "sysemu/dma.h"
+#include "sysemu/xen.h"
 #include "sysemu/runstate.h"
 #include "virtio-qmp.h"
 
@@ -112,6 +113,29 @@ typedef struct VRing
     VRingMemoryRegionCaches *caches;
 } VRing;
 
+/*
+ * Translations of guest-physical RAM ranges recently used by descriptor
+ * buffers, so that mapping them does not need a FlatView lookup.  Only
+ * touched by the thread that processes the virtqueue.
+ */
+#define VIRTQUEUE_MAP_CACHE_SIZE 4
+
+typedef struct VirtQueueMapEntry {
+    hwaddr addr;
+    hwaddr len;
+    void *host;
+    MemoryRegion *mr;
+    bool writable;
+} VirtQueueMapEntry;
+
+typedef struct VirtQueueMapCache {
+    VirtQueueMapEntry entries[VIRTQUEUE_MAP_CACHE_SIZE];
+    unsigned int next;
+    /* FlatView and VirtIODevice::map_cache_gen the entries belong to */
+    FlatView *fv;
+    uint32_t gen;
+} VirtQueueMapCache;
+
 typedef struct VRingPackedDescEvent {
     uint16_t off_wrap;
     uint16_t flags;
@@ -146,6 +170,25 @@ struct VirtQueue
 
     unsigned int inuse;
 
+    VirtQueueMapCache map_cache;
+
+    /*
+     * Notification coalescing, see virtio_queue_set_notification_coalescing().
+     * The timer runs in @coalesce_ctx, or in the main loop if it is NULL.
+     */
+    QEMUTimer *coalesce_timer;
+    AioContext *coalesce_ctx;
+    int64_t coalesce_last_ns;
+    uint32_t coalesce_usecs;
+    uint32_t coalesce_max_frames;
+    uint32_t coalesce_pending;
+    bool coalesce_irqfd;
+    /* Adaptive mode: completion rate sample and the interval it chose */
+    bool coalesce_adaptive;
+    uint32_t coalesce_cur_usecs;
+    uint32_t coalesce_sample_count;
+    int64_t coalesce_sample_ns;
+
     uint16_t vector;
     VirtIOHandleOutput handle_output;
     VirtIODevice *vdev;
@@ -1365,11 +1408,80 @@ int virtqueue_avail_bytes(VirtQueue *vq, unsigned int in_bytes,
     return in_bytes <= in_total && out_bytes <= out_total;
 }
 
-static bool virtqueue_map_desc(VirtIODevice *vdev, unsigned int *p_num_sg,
+/*
+ * Map [pa, pa + *plen) through the virtqueue's translation cache.  On a hit
+ * this is a range check, plus the reference that address_space_unmap()
+ * drops again.  On a miss the translation is done once for the rest of the
+ * RAM section that contains @pa, which is then remembered.
+ *
+ * Entries are only used while the FlatView they were translated from is
+ * still current, so the memory regions they point to are kept alive by our
+ * RCU critical section.  The device's generation, bumped by
+ * virtio_memory_listener_commit() and read after the FlatView, protects
+ * against a new FlatView reusing the address of a freed one.
+ *
+ * Called within rcu_read_lock().
+ */
+static void *virtqueue_map_cached(VirtQueue *vq, hwaddr pa, hwaddr *plen,
+                                  bool is_write)
+{
+    VirtIODevice *vdev = vq->vdev;
+    VirtQueueMapCache *cache = &vq->map_cache;
+    VirtQueueMapEntry *e;
+    MemoryRegion *mr;
+    FlatView *fv;
+    hwaddr xlat, l;
+    uint32_t gen;
+    int i;
+
+    if (vdev->dma_as != &address_space_memory || xen_enabled()) {
+        /* IOMMU mappings can change behind the listener's back */
+        return NULL;
+    }
+
+    fv = address_space_to_flatview(vdev->dma_as);
+    gen = qatomic_load_acquire(&vdev->map_cache_gen);
+    if (cache->fv != fv || cache->gen != gen) {
+        memset(cache->entries, 0, sizeof(cache->entries));
+        cache->fv = fv;
+        cache->gen = gen;
+    }
+
+    for (i = 0; i < VIRTQUEUE_MAP_CACHE_SIZE; i++) {
+        e = &cache->entries[i];
+        if (pa - e->addr < e->len && (e->writable || !is_write)) {
+            goto hit;
+        }
+    }
+
+    l = HWADDR_MAX - pa;
+    mr = flatview_translate(fv, pa, &xlat, &l, is_write,
+                            MEMTXATTRS_UNSPECIFIED);
+    if (!memory_region_is_ram(mr) || memory_region_is_ram_device(mr) ||
+        !memory_access_is_direct(mr, is_write)) {
+        return NULL;
+    }
+
+    e = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % VIRTQUEUE_MAP_CACHE_SIZE;
+    e->addr = pa;
+    e->len = l;
+    e->host = qemu_map_ram_ptr(mr->ram_block, xlat);
+    e->mr = mr;
+    e->writable = memory_access_is_direct(mr, true);
+
+hit:
+    *plen = MIN(*plen, e->len - (pa - e->addr));
+    memory_region_ref(e->mr);
+    return e->host + (pa - e->addr);
+}
+
+static bool virtqueue_map_desc(VirtQueue *vq, unsigned int *p_num_sg,
                                hwaddr *addr, struct iovec *iov,
                                unsigned int max_num_sg, bool is_write,
                                hwaddr pa, size_t sz)
 {
+    VirtIODevice *vdev = vq->vdev;
     bool ok = false;
     unsigned num_sg = *p_num_sg;
     assert(num_sg <= max_num_sg);
@@ -1388,11 +1500,14 @@ static bool virtqueue_map_desc(VirtIODevice *vdev, unsigned int *p_num_sg,
             goto out;
         }
 
-        iov[num_sg].iov_base = dma_memory_map(vdev->dma_as, pa, &len,
-                                              is_write ?
-                                              DMA_DIRECTION_FROM_DEVICE :
-                                              DMA_DIRECTION_TO_DEVICE,
-                                              MEMTXATTRS_UNSPECIFIED);
+        iov[num_sg].iov_base = virtqueue_map_cached(vq, pa, &len, is_write);
+        if (!iov[num_sg].iov_base) {
+            iov[num_sg].iov_base = dma_memory_map(vdev->dma_as, pa, &len,
+                                                  is_write ?
+                                                  DMA_DIRECTION_FROM_DEVICE :
+                                                  DMA_DIRECTION_TO_DEVICE,
+                                                  MEMTXATTRS_UNSPECIFIED);
+        }
         if (!iov[num_sg].iov_base) {
             virtio_error(vdev, "virtio: bogus descriptor or out of resources");
             goto out;
@@ -1483,6 +1598,7 @@ static void *virtqueue_alloc_element(size_t sz, unsigned out_num, unsigned in_nu
     return elem;
 }
 
+/* Called within rcu_read_lock().  */
 static void *virtqueue_split_pop(VirtQueue *vq, size_t sz)
 {
     unsigned int i, head, max;
@@ -1498,7 +1614,6 @@ static void *virtqueue_split_pop(VirtQueue *vq, size_t sz)
     VRingDesc desc;
     int rc;
 
-    RCU_READ_LOCK_GUARD();
     if (virtio_queue_empty_rcu(vq)) {
         goto done;
     }
@@ -1564,7 +1679,7 @@ static void *virtqueue_split_pop(VirtQueue *vq, size_t sz)
         bool map_ok;
 
         if (desc.flags & VRING_DESC_F_WRITE) {
-            map_ok = virtqueue_map_desc(vdev, &in_num, addr + out_num,
+            map_ok = virtqueue_map_desc(vq, &in_num, addr + out_num,
                                         iov + out_num,
                                         VIRTQUEUE_MAX_SIZE - out_num, true,
                                         desc.addr, desc.len);
@@ -1573,7 +1688,7 @@ static void *virtqueue_split_pop(VirtQueue *vq, size_t sz)
                 virtio_error(vdev, "Incorrect order for descriptors");
                 goto err_undo_map;
             }
-            map_ok = virtqueue_map_desc(vdev, &out_num, addr, iov,
+            map_ok = virtqueue_map_desc(vq, &out_num, addr, iov,
                                         VIRTQUEUE_MAX_SIZE, false,
                                         desc.addr, desc.len);
         }
@@ -1620,6 +1735,7 @@ err_undo_map:
     goto done;
 }
 
+/* Called within rcu_read_lock().  */
 static void *virtqueue_packed_pop(VirtQueue *vq, size_t sz)
 {
     unsigned int i, max;
@@ -1636,7 +1752,6 @@ static void *virtqueue_packed_pop(VirtQueue *vq, size_t sz)
     uint16_t id;
     int rc;
 
-    RCU_READ_LOCK_GUARD();
     if (virtio_queue_packed_empty_rcu(vq)) {
         goto done;
     }
@@ -1692,7 +1807,7 @@ static void *virtqueue_packed_pop(VirtQueue *vq, size_t sz)
         bool map_ok;
 
         if (desc.flags & VRING_DESC_F_WRITE) {
-            map_ok = virtqueue_map_desc(vdev, &in_num, addr + out_num,
+            map_ok = virtqueue_map_desc(vq, &in_num, addr + out_num,
                                         iov + out_num,
                                         VIRTQUEUE_MAX_SIZE - out_num, true,
                                         desc.addr, desc.len);
@@ -1701,7 +1816,7 @@ static void *virtqueue_packed_pop(VirtQueue *vq, size_t sz)
                 virtio_error(vdev, "Incorrect order for descriptors");
                 goto err_undo_map;
             }
-            map_ok = virtqueue_map_desc(vdev, &out_num, addr, iov,
+            map_ok = virtqueue_map_desc(vq, &out_num, addr, iov,
                                         VIRTQUEUE_MAX_SIZE, false,
                                         desc.addr, desc.len);
         }
@@ -1761,6 +1876,7 @@ void *virtqueue_pop(VirtQueue *vq, size_t sz)
         return NULL;
     }
 
+    RCU_READ_LOCK_GUARD();
     if (virtio_vdev_has_feature(vq->vdev, VIRTIO_F_RING_PACKED)) {
         return virtqueue_packed_pop(vq, sz);
     } else {
@@ -1768,6 +1884,86 @@ void *virtqueue_pop(VirtQueue *vq, size_t sz)
     }
 }
 
+/*
+ * Start pulling the head descriptor of the avail ring entry @idx into the
+ * cache, so that it is hot by the time virtqueue_split_pop() gets to it.
+ *
+ * Called within rcu_read_lock().
+ */
+static void virtqueue_split_prefetch_head(VirtQueue *vq, unsigned int idx)
+{
+    VRingMemoryRegionCaches *caches = vring_get_region_caches(vq);
+    unsigned int head;
+
+    if (!caches || !caches->desc.ptr) {
+        return;
+    }
+
+    head = vring_avail_ring(vq, idx % vq->vring.num);
+    if (head < vq->vring.num &&
+        caches->desc.len >= (head + 1) * sizeof(VRingDesc)) {
+        __builtin_prefetch(caches->desc.ptr + head * sizeof(VRingDesc));
+    }
+}
+
+static unsigned int virtqueue_split_pop_batch(VirtQueue *vq, size_t sz,
+                                              void **elems, unsigned int max)
+{
+    unsigned int n, avail;
+
+    if (virtio_queue_empty_rcu(vq)) {
+        return 0;
+    }
+
+    /*
+     * virtio_queue_empty_rcu() only loads the guest's avail index when the
+     * shadow copy is exhausted, so everything up to shadow_avail_idx can be
+     * popped without touching it again.
+     */
+    avail = (uint16_t)(vq->shadow_avail_idx - vq->last_avail_idx);
+    max = MIN(max, avail);
+
+    for (n = 0; n < max; n++) {
+        if (n + 1 < max) {
+            virtqueue_split_prefetch_head(vq, vq->last_avail_idx + 1);
+        }
+        elems[n] = virtqueue_split_pop(vq, sz);
+        if (!elems[n]) {
+            break;
+        }
+    }
+    return n;
+}
+
+static unsigned int virtqueue_packed_pop_batch(VirtQueue *vq, size_t sz,
+                                               void **elems, unsigned int max)
+{
+    unsigned int n;
+
+    for (n = 0; n < max; n++) {
+        elems[n] = virtqueue_packed_pop(vq, sz);
+        if (!elems[n]) {
+            break;
+        }
+    }
+    return n;
+}
+
+unsigned int virtqueue_pop_batch(VirtQueue *vq, size_t sz, void **elems,
+                                 unsigned int max)
+{
+    if (virtio_device_disabled(vq->vdev)) {
+        return 0;
+    }
+
+    RCU_READ_LOCK_GUARD();
+    if (virtio_vdev_has_feature(vq->vdev, VIRTIO_F_RING_PACKED)) {
+        return virtqueue_packed_pop_batch(vq, sz, elems, max);
+    } else {
+        return virtqueue_split_pop_batch(vq, sz, elems, max);
+    }
+}
+
 static unsigned int virtqueue_packed_drop_all(VirtQueue *vq)
 {
     VRingMemoryRegionCaches *caches;
@@ -2071,6 +2267,10 @@ static void __virtio_queue_reset(VirtIODevice *vdev, uint32_t i)
     vdev->vq[i].notification = true;
     vdev->vq[i].vring.num = vdev->vq[i].vring.num_default;
     vdev->vq[i].inuse = 0;
+    vdev->vq[i].coalesce_pending = 0;
+    if (vdev->vq[i].coalesce_timer) {
+        timer_del(vdev->vq[i].coalesce_timer);
+    }
     virtio_virtqueue_reset_region_cache(&vdev->vq[i]);
 }
 
@@ -2318,6 +2518,16 @@ VirtQueue *virtio_add_queue(VirtIODevice *vdev, int queue_size,
     return &vdev->vq[i];
 }
 
+static void virtio_queue_coalesce_cleanup(VirtQueue *vq)
+{
+    /* The queue is gone, drop a held back notification instead of sending it */
+    vq->coalesce_usecs = 0;
+    vq->coalesce_max_frames = 0;
+    vq->coalesce_pending = 0;
+    timer_free(vq->coalesce_timer);
+    vq->coalesce_timer = NULL;
+}
+
 void virtio_delete_queue(VirtQueue *vq)
 {
     vq->vring.num = 0;
@@ -2326,6 +2536,7 @@ void virtio_delete_queue(VirtQueue *vq)
     g_free(vq->used_elems);
     vq->used_elems = NULL;
     virtio_virtqueue_reset_region_cache(vq);
+    virtio_queue_coalesce_cleanup(vq);
 }
 
 void virtio_del_queue(VirtIODevice *vdev, int n)
@@ -2426,7 +2637,14 @@ static bool virtio_should_notify(VirtIODevice *vdev, VirtQueue *vq)
     }
 }
 
-void virtio_notify_irqfd(VirtIODevice *vdev, VirtQueue *vq)
+bool virtio_queue_should_notify(VirtIODevice *vdev, VirtQueue *vq)
+{
+    RCU_READ_LOCK_GUARD();
+
+    return virtio_should_notify(vdev, vq);
+}
+
+static void virtio_do_notify_irqfd(VirtIODevice *vdev, VirtQueue *vq)
 {
     WITH_RCU_READ_LOCK_GUARD() {
         if (!virtio_should_notify(vdev, vq)) {
@@ -2461,7 +2679,7 @@ static void virtio_irq(VirtQueue *vq)
     virtio_notify_vector(vq->vdev, vq->vector);
 }
 
-void virtio_notify(VirtIODevice *vdev, VirtQueue *vq)
+static void virtio_do_notify(VirtIODevice *vdev, VirtQueue *vq)
 {
     WITH_RCU_READ_LOCK_GUARD() {
         if (!virtio_should_notify(vdev, vq)) {
@@ -2473,6 +2691,163 @@ void virtio_notify(VirtIODevice *vdev, VirtQueue *vq)
     virtio_irq(vq);
 }
 
+/* Deliver the notification held back by coalescing, if any */
+static void virtio_queue_coalesce_flush(VirtQueue *vq)
+{
+    if (!vq->coalesce_pending) {
+        return;
+    }
+
+    timer_del(vq->coalesce_timer);
+    vq->coalesce_pending = 0;
+    vq->coalesce_last_ns = qemu_clock_get_ns(QEMU_CLOCK_VIRTUAL);
+    if (vq->coalesce_irqfd) {
+        virtio_do_notify_irqfd(vq->vdev, vq);
+    } else {
+        virtio_do_notify(vq->vdev, vq);
+    }
+}
+
+static void virtio_queue_coalesce_timer_cb(void *opaque)
+{
+    virtio_queue_coalesce_flush(opaque);
+}
+
+/*
+ * Adaptive coalescing measures the completion rate over windows of at
+ * least VIRTIO_COALESCE_SAMPLE_NS.  Below the low rate notifications are
+ * not held back at all; from there the interval grows linearly up to
+ * coalesce_usecs, which is reached at the high rate.  Rates are in
+ * completions per millisecond.
+ */
+#define VIRTIO_COALESCE_SAMPLE_NS   SCALE_MS
+#define VIRTIO_COALESCE_LOW_RATE    8
+#define VIRTIO_COALESCE_HIGH_RATE   64
+
+static uint32_t virtio_queue_coalesce_usecs(VirtQueue *vq, int64_t now)
+{
+    int64_t elapsed;
+    uint64_t rate;
+
+    if (!vq->coalesce_adaptive) {
+        return vq->coalesce_usecs;
+    }
+
+    vq->coalesce_sample_count++;
+    elapsed = now - vq->coalesce_sample_ns;
+    if (elapsed < VIRTIO_COALESCE_SAMPLE_NS) {
+        return vq->coalesce_cur_usecs;
+    }
+
+    rate = (uint64_t)vq->coalesce_sample_count * SCALE_MS / elapsed;
+    if (rate <= VIRTIO_COALESCE_LOW_RATE) {
+        vq->coalesce_cur_usecs = 0;
+    } else if (rate >= VIRTIO_COALESCE_HIGH_RATE) {
+        vq->coalesce_cur_usecs = vq->coalesce_usecs;
+    } else {
+        vq->coalesce_cur_usecs = (uint64_t)vq->coalesce_usecs *
+                                 (rate - VIRTIO_COALESCE_LOW_RATE) /
+                                 (VIRTIO_COALESCE_HIGH_RATE -
+                                  VIRTIO_COALESCE_LOW_RATE);
+    }
+    vq->coalesce_sample_count = 0;
+    vq->coalesce_sample_ns = now;
+    return vq->coalesce_cur_usecs;
+}
+
+/*
+ * The first completion after an idle period is signalled right away, so
+ * that coalescing adds no latency at low request rates.  Completions that
+ * follow within the coalescing interval of the last notification are held
+ * back until that period expires or coalesce_max_frames of them have
+ * accumulated, which caps the interrupt rate under load.
+ *
+ * Returns true if the notification was deferred.
+ */
+static bool virtio_queue_coalesce(VirtQueue *vq, bool irqfd)
+{
+    int64_t now, deadline;
+
+    if (!vq->coalesce_timer) {
+        return false;
+    }
+
+    vq->coalesce_irqfd = irqfd;
+    vq->coalesce_pending++;
+    now = qemu_clock_get_ns(QEMU_CLOCK_VIRTUAL);
+    deadline = vq->coalesce_last_ns +
+               (int64_t)virtio_queue_coalesce_usecs(vq, now) * SCALE_US;
+
+    if (now < deadline &&
+        (!vq->coalesce_max_frames ||
+         vq->coalesce_pending < vq->coalesce_max_frames)) {
+        if (!timer_pending(vq->coalesce_timer)) {
+            timer_mod(vq->coalesce_timer, deadline);
+        }
+        return true;
+    }
+
+    timer_del(vq->coalesce_timer);
+    vq->coalesce_pending = 0;
+    vq->coalesce_last_ns = now;
+    return false;
+}
+
+static void virtio_queue_coalesce_set_context(VirtQueue *vq, AioContext *ctx)
+{
+    vq->coalesce_ctx = ctx;
+    if (!vq->coalesce_timer) {
+        return;
+    }
+
+    virtio_queue_coalesce_flush(vq);
+    timer_free(vq->coalesce_timer);
+    vq->coalesce_timer = aio_timer_new(ctx ?: qemu_get_aio_context(),
+                                       QEMU_CLOCK_VIRTUAL, SCALE_NS,
+                                       virtio_queue_coalesce_timer_cb, vq);
+}
+
+void virtio_queue_set_notification_coalescing(VirtQueue *vq, uint32_t usecs,
+                                              uint32_t max_frames,
+                                              bool adaptive)
+{
+    vq->coalesce_usecs = usecs;
+    vq->coalesce_max_frames = max_frames;
+    vq->coalesce_adaptive = adaptive;
+    vq->coalesce_cur_usecs = 0;
+    vq->coalesce_sample_count = 0;
+
+    if (usecs && !vq->coalesce_timer) {
+        /* Start out idle, so that the first completion is not held back */
+        vq->coalesce_last_ns = INT64_MIN / 2;
+        vq->coalesce_sample_ns = INT64_MIN / 2;
+        vq->coalesce_timer = aio_timer_new(vq->coalesce_ctx ?:
+                                           qemu_get_aio_context(),
+                                           QEMU_CLOCK_VIRTUAL, SCALE_NS,
+                                           virtio_queue_coalesce_timer_cb, vq);
+    } else if (!usecs && vq->coalesce_timer) {
+        virtio_queue_coalesce_flush(vq);
+        timer_free(vq->coalesce_timer);
+        vq->coalesce_timer = NULL;
+    }
+}
+
+void virtio_notify_irqfd(VirtIODevice *vdev, VirtQueue *vq)
+{
+    if (virtio_queue_coalesce(vq, true)) {
+        return;
+    }
+    virtio_do_notify_irqfd(vdev, vq);
+}
+
+void virtio_notify(VirtIODevice *vdev, VirtQueue *vq)
+{
+    if (virtio_queue_coalesce(vq, false)) {
+        return;
+    }
+    virtio_do_notify(vdev, vq);
+}
+
 void virtio_notify_config(VirtIODevice *vdev)
 {
     if (!(vdev->status & VIRTIO_CONFIG_S_DRIVER_OK))
@@ -3136,6 +3511,18 @@ static void virtio_vmstate_change(void *opaque, bool running, RunState state)
     if (!backend_run) {
         virtio_set_status(vdev, vdev->status);
     }
+
+    if (!running) {
+        /* Do not leave notifications behind in a stopped timer */
+        for (int i = 0; i < VIRTIO_QUEUE_MAX; i++) {
+            if (vdev->vq[i].vring.num == 0) {
+                break;
+            }
+            if (!vdev->vq[i].coalesce_ctx) {
+                virtio_queue_coalesce_flush(&vdev->vq[i]);
+            }
+        }
+    }
 }
 
 void virtio_instance_init_common(Object *proxy_obj, void *data,
@@ -3491,6 +3878,7 @@ static void virtio_queue_host_notifier_aio_poll_end(EventNotifier *n)
 
 void virtio_queue_aio_attach_host_notifier(VirtQueue *vq, AioContext *ctx)
 {
+    virtio_queue_coalesce_set_context(vq, ctx);
     aio_set_event_notifier(ctx, &vq->host_notifier, true,
                            virtio_queue_host_notifier_read,
                            virtio_queue_host_notifier_aio_poll,
@@ -3508,6 +3896,7 @@ void virtio_queue_aio_attach_host_notifier(VirtQueue *vq, AioContext *ctx)
  */
 void virtio_queue_aio_attach_host_notifier_no_poll(VirtQueue *vq, AioContext *ctx)
 {
+    virtio_queue_coalesce_set_context(vq, ctx);
     aio_set_event_notifier(ctx, &vq->host_notifier, true,
                            virtio_queue_host_notifier_read,
                            NULL, NULL);
@@ -3519,6 +3908,7 @@ void virtio_queue_aio_detach_host_notifier(VirtQueue *vq, AioContext *ctx)
     /* Test and clear notifier before after disabling event,
      * in case poll callback didn't have time to run. */
     virtio_queue_host_notifier_read(&vq->host_notifier);
+    virtio_queue_coalesce_set_context(vq, NULL);
 }
 
 void virtio_queue_host_notifier_read(EventNotifier *n)
@@ -3584,6 +3974,9 @@ static void virtio_memory_listener_commit(MemoryListener *listener)
     VirtIODevice *vdev = container_of(listener, VirtIODevice, listener);
     int i;
 
+    /* See virtqueue_map_cached() */
+    qatomic_store_release(&vdev->map_cache_gen, vdev->map_cache_gen + 1);
+
     for (i = 0; i < VIRTIO_QUEUE_MAX; i++) {
         if (vdev->vq[i].vring.num == 0) {
             break;
@@ -3651,6 +4044,7 @@ static void virtio_device_free_virtqueues(VirtIODevice *vdev)
             break;
         }
         virtio_virtqueue_reset_region_cache(&vdev->vq[i]);
+        virtio_queue_coalesce_cleanup(&vdev->vq[i]);
     }
     g_free(vdev->vq);
 }
@@ -22,6 +22,7 @@
 #include "qemu/event_notifier.h"
 #include "qemu/thread.h"
 #include "qemu/timer.h"
+#include "qemu/stats64.h"
 #include "block/graph-lock.h"
 
 typedef struct BlockAIOCB BlockAIOCB;
@@ -104,8 +105,35 @@ typedef struct {
      * Returns: true if ->wait() should be called, false otherwise.
      */
     bool (*need_wait)(AioContext *ctx);
+
+    /*
+     * dispatch:
+     * @ctx: the AioContext
+     *
+     * Run the completion callbacks of requests, other than file descriptor
+     * monitoring, that ->wait() collected.  Optional.
+     *
+     * Returns: true if progress was made, false otherwise.
+     */
+    bool (*dispatch)(AioContext *ctx);
 } FDMonOps;
 
+#ifdef CONFIG_LINUX_IO_URING
+typedef struct CqeHandler CqeHandler;
+typedef void CqeHandlerFunc(CqeHandler *cqe_handler);
+
+/* A request submitted to the AioContext's io_uring with aio_add_sqe() */
+struct CqeHandler {
+    CqeHandlerFunc *cb;
+
+    /* Filled in with the completion before @cb is called */
+    struct io_uring_cqe cqe;
+
+    QLIST_ENTRY(CqeHandler) node_inflight;
+    QSIMPLEQ_ENTRY(CqeHandler) next;
+};
+#endif
+
 /*
  * Each aio_bh_poll() call carves off a slice of the BH list, so that newly
  * scheduled BHs are not processed until the next aio_bh_poll() call.  All
@@ -121,6 +149,20 @@ struct BHListSlice {
 
 typedef QSLIST_HEAD(, AioHandler) AioHandlerSList;
 
+/*
+ * Latencies of handler events, measured from the start of aio_poll(), are
+ * kept in log2 buckets: bucket 0 counts events that were already pending and
+ * bucket i counts those that took [2^(i-1), 2^i) nanoseconds.  The last
+ * bucket also counts anything slower.
+ */
+#define AIO_POLL_LATENCY_BUCKETS 32
+
+typedef struct {
+    Stat64 poll_hits;       /* events found by userspace polling */
+    Stat64 fd_events;       /* events reported by fd monitoring */
+    Stat64 latency[AIO_POLL_LATENCY_BUCKETS];
+} AioPollStats;
+
 struct AioContext {
     GSource source;
 
@@ -224,6 +266,16 @@ struct AioContext {
     /* State for file descriptor monitoring using Linux io_uring */
     struct io_uring fdmon_io_uring;
     AioHandlerSList submit_list;
+    bool fdmon_io_uring_multishot;
+
+    /* Handlers with events held back while external clients are disabled */
+    AioHandlerList fdmon_io_uring_deferred;
+
+    /* aio_add_sqe() requests that have not completed yet */
+    QLIST_HEAD(, CqeHandler) cqe_handler_inflight_list;
+
+    /* aio_add_sqe() requests that completed but have not been dispatched */
+    QSIMPLEQ_HEAD(, CqeHandler) cqe_handler_ready_list;
 #endif
 
     /* TimerLists for calling timers - one per clock type.  Has its own
@@ -237,11 +289,17 @@ struct AioContext {
     int poll_disable_cnt;
 
     /* Polling mode parameters */
-    int64_t poll_ns;        /* current polling time in nanoseconds */
+    int64_t poll_ns;        /* longest polling time of any handler, in ns */
     int64_t poll_max_ns;    /* maximum polling time in nanoseconds */
     int64_t poll_grow;      /* polling time growth factor */
     int64_t poll_shrink;    /* polling time shrink factor */
 
+    /*
+     * Polling statistics summed over all handlers.  Only updated by the
+     * event loop thread, but may be read from any thread.
+     */
+    AioPollStats poll_stats;
+
     /* AIO engine parameters */
     int64_t aio_max_batch;  /* maximum number of requests in a batch */
 
@@ -256,6 +314,12 @@ struct AioContext {
     /* Are we in polling mode or monitoring file descriptors? */
     bool poll_started;
 
+    /* Are some handlers with .io_poll() left to fd monitoring? */
+    bool poll_unpolled;
+
+    /* Consecutive aio_poll() calls that skipped fd monitoring */
+    unsigned poll_fd_skipped;
+
     /* epoll(7) state used when built with CONFIG_EPOLL */
     int epollfd;
 
@@ -524,6 +588,42 @@ struct LuringState *aio_setup_linux_io_uring(AioContext *ctx, Error **errp);
 
 /* Return the LuringState bound to this AioContext */
 struct LuringState *aio_get_linux_io_uring(AioContext *ctx);
+
+#ifdef CONFIG_LINUX_IO_URING
+/**
+ * aio_has_io_uring:
+ * @ctx: the aio context
+ *
+ * Return whether @ctx monitors file descriptors with io_uring, in which case
+ * aio_add_sqe() can be used.
+ */
+bool aio_has_io_uring(AioContext *ctx);
+
+/**
+ * aio_add_sqe:
+ * @ctx: the aio context
+ * @prep_sqe: function that fills in the sqe
+ * @opaque: data for @prep_sqe
+ * @cqe_handler: called from aio_poll() once the request completes
+ *
+ * Add a request to the io_uring used by @ctx for file descriptor monitoring.
+ * It is submitted by the next aio_poll(), together with any changes to the
+ * monitored file descriptors, and its completion is processed alongside fd
+ * events, so that one io_uring_enter(2) system call handles both.
+ *
+ * @prep_sqe must not set the sqe's user_data, which belongs to @ctx.
+ *
+ * If @ctx stops using io_uring before the request completes, the request is
+ * cancelled and @cqe_handler is called with -ECANCELED unless the request
+ * completed in the meantime.
+ *
+ * Must only be called from the home thread of @ctx, and only if
+ * aio_has_io_uring() returns true.
+ */
+void aio_add_sqe(AioContext *ctx,
+                 void (*prep_sqe)(struct io_uring_sqe *sqe, void *opaque),
+                 void *opaque, CqeHandler *cqe_handler);
+#endif
 /**
  * aio_timer_new_with_attrs:
  * @ctx: the aio context
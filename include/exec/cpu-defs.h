@@ -179,6 +179,16 @@ typedef struct CPUTLBDesc {
      */
     target_ulong large_page_addr;
     target_ulong large_page_mask;
+    /*
+     * The most recent large page translation installed into the tlb,
+     * with @lp_fill_full.phys_addr aligned to the large page size.
+     * When large page fill is enabled, a miss on another small page
+     * within the same large page is refilled from this entry without
+     * another walk of the guest page tables.  The entry is not valid
+     * when lp_fill_addr == -1.
+     */
+    target_ulong lp_fill_addr;
+    CPUTLBEntryFull lp_fill_full;
     /* host time (in ns) at the beginning of the time window */
     int64_t window_begin_ns;
     /* maximum number of entries observed in the window */
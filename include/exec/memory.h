@@ -2544,6 +2544,49 @@ void address_space_destroy(AddressSpace *as);
  */
 void address_space_remove_listeners(AddressSpace *as);
 
+#define MMIO_DISPATCH_CACHE_SIZE 4
+
+typedef struct MMIODispatchCacheEntry {
+    AddressSpace *as;
+    unsigned generation;
+    hwaddr start;
+    hwaddr size;
+    MemoryRegion *mr;
+    hwaddr offset_within_region;
+} MMIODispatchCacheEntry;
+
+/*
+ * A small cache of the MMIO sections recently accessed by one vCPU.  It
+ * is only valid as long as the memory map does not change, which is
+ * checked against a generation count on every lookup.
+ */
+struct MMIODispatchCache {
+    MMIODispatchCacheEntry entries[MMIO_DISPATCH_CACHE_SIZE];
+    unsigned next;
+};
+
+/**
+ * address_space_mmio_rw: read from or write to MMIO on behalf of a vCPU.
+ *
+ * Like address_space_rw(), but meant for the single aligned accesses
+ * that accelerators report when the guest touches emulated devices.
+ * Such accesses are looked up in @cache first, which skips the address
+ * space translation for the registers that a vCPU hits repeatedly.
+ * Anything that is not a single access to an MMIO region falls back to
+ * address_space_rw().
+ *
+ * @as: #AddressSpace to be accessed
+ * @cache: the accessing vCPU's #MMIODispatchCache
+ * @addr: address within that address space
+ * @attrs: memory transaction attributes
+ * @buf: buffer with the data transferred
+ * @len: the number of bytes to read or write
+ * @is_write: indicates the transfer direction
+ */
+MemTxResult address_space_mmio_rw(AddressSpace *as, MMIODispatchCache *cache,
+                                  hwaddr addr, MemTxAttrs attrs,
+                                  void *buf, hwaddr len, bool is_write);
+
 /**
  * address_space_rw: read from or write to an address space.
  *
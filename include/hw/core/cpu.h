@@ -306,6 +306,7 @@ struct qemu_work_item;
  * @opaque: User data.
  * @mem_io_pc: Host Program Counter at which the memory was accessed.
  * @kvm_fd: vCPU file descriptor for KVM.
+ * @mmio_cache: MMIO sections recently accessed by this vCPU's MMIO exits.
  * @work_mutex: Lock to prevent multiple access to @work_list.
  * @work_list: List of pending asynchronous work.
  * @trace_dstate_delayed: Delayed changes to trace_dstate (includes all changes
@@ -397,6 +398,7 @@ struct CPUState {
     struct KVMState *kvm_state;
     struct kvm_run *kvm_run;
     struct kvm_dirty_gfn *kvm_dirty_gfns;
+    MMIODispatchCache *mmio_cache;
     uint32_t kvm_fetch_index;
     uint64_t dirty_pages;
 
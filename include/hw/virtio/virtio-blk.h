@@ -45,6 +45,9 @@ struct VirtIOBlkConf
     bool report_discard_granularity;
     uint32_t max_discard_sectors;
     uint32_t max_write_zeroes_sectors;
+    uint32_t coalesce_usecs;
+    uint32_t coalesce_max_frames;
+    bool coalesce_adaptive;
     bool x_enable_wce_if_config_wce;
 };
 
@@ -45,6 +45,12 @@ typedef struct virtio_net_conf
     char *tx;
     uint16_t rx_queue_size;
     uint16_t tx_queue_size;
+    uint32_t rx_coalesce_usecs;
+    uint32_t rx_coalesce_max_frames;
+    uint32_t tx_coalesce_usecs;
+    uint32_t tx_coalesce_max_frames;
+    bool rx_coalesce_adaptive;
+    bool tx_coalesce_adaptive;
     uint16_t mtu;
     int32_t speed;
     char *duplex_str;
@@ -145,6 +151,8 @@ typedef struct VirtioNetRssData {
     uint16_t default_queue;
 } VirtioNetRssData;
 
+typedef struct VirtioNetFlowTable VirtioNetFlowTable;
+
 typedef struct VirtIONetQueue {
     VirtQueue *rx_vq;
     VirtQueue *tx_vq;
@@ -153,7 +161,17 @@ typedef struct VirtIONetQueue {
     uint32_t tx_waiting;
     struct {
         VirtQueueElement *elem;
+        /* segments of elem queued by the net layer, see x-sw-gso */
+        unsigned int sw_gso_pending;
     } async_tx;
+    /* used ring entries filled but not yet flushed by a batched receive */
+    bool rx_batching;
+    unsigned int rx_batch_pending;
+    /* ran out of receive buffers, steer new flows elsewhere */
+    bool rx_starved;
+    /* rx_starved as last written to the eBPF queue load map, and when */
+    bool rx_starved_published;
+    int64_t rx_starved_published_ns;
     struct VirtIONet *n;
 } VirtIONetQueue;
 
@@ -219,6 +237,15 @@ struct VirtIONet {
     VirtioNetRssData rss_data;
     struct NetRxPkt *rx_pkt;
     struct EBPFRSSContext ebpf_rss;
+    bool rx_gro;
+    uint8_t *rx_gro_buf;
+    /* segment and checksum in software what the peer cannot offload */
+    bool sw_gso;
+    struct NetTxPkt *tx_pkt;
+    uint8_t *tx_sw_gso_buf;
+    /* RSS flow affinity and load-aware steering */
+    bool flow_steering;
+    VirtioNetFlowTable *flows;
 };
 
 size_t virtio_net_handle_ctrl_iov(VirtIODevice *vdev,
@@ -129,6 +129,8 @@ struct VirtIODevice
     int nvectors;
     VirtQueue *vq;
     MemoryListener listener;
+    /* bumped by @listener to invalidate the virtqueue translation caches */
+    uint32_t map_cache_gen;
     uint16_t device_id;
     /* @vm_running: current VM running state via virtio_vmstate_change() */
     bool vm_running;
@@ -248,6 +250,22 @@ void virtqueue_fill(VirtQueue *vq, const VirtQueueElement *elem,
 
 void virtqueue_map(VirtIODevice *vdev, VirtQueueElement *elem);
 void *virtqueue_pop(VirtQueue *vq, size_t sz);
+
+/**
+ * virtqueue_pop_batch() - pop up to @max elements from a virtqueue
+ * @vq: the virtqueue
+ * @sz: size of each element, as for virtqueue_pop()
+ * @elems: array that receives the popped elements
+ * @max: number of entries in @elems
+ *
+ * Equivalent to calling virtqueue_pop() until it returns NULL or @max
+ * elements have been popped, but the RCU read lock is taken and the guest's
+ * avail index is read only once for the whole batch.
+ *
+ * Returns: the number of elements stored in @elems.
+ */
+unsigned int virtqueue_pop_batch(VirtQueue *vq, size_t sz, void **elems,
+                                 unsigned int max);
 unsigned int virtqueue_drop_all(VirtQueue *vq);
 void *qemu_get_virtqueue_element(VirtIODevice *vdev, QEMUFile *f, size_t sz);
 void qemu_put_virtqueue_element(VirtIODevice *vdev, QEMUFile *f,
@@ -258,9 +276,36 @@ void virtqueue_get_avail_bytes(VirtQueue *vq, unsigned int *in_bytes,
                                unsigned int *out_bytes,
                                unsigned max_in_bytes, unsigned max_out_bytes);
 
+/**
+ * virtio_queue_set_notification_coalescing() - moderate used buffer
+ * notifications
+ * @vq: the virtqueue
+ * @usecs: minimum interval between notifications, 0 disables coalescing
+ * @max_frames: notify anyway once this many completions are pending, or
+ * 0 for no limit
+ * @adaptive: scale the interval from 0 up to @usecs with the completion
+ * rate, like adaptive interrupt moderation on NICs
+ *
+ * Applies to both virtio_notify() and virtio_notify_irqfd().  Must be
+ * called while the virtqueue is not being processed in another thread.
+ */
+void virtio_queue_set_notification_coalescing(VirtQueue *vq, uint32_t usecs,
+                                              uint32_t max_frames,
+                                              bool adaptive);
 void virtio_notify_irqfd(VirtIODevice *vdev, VirtQueue *vq);
 void virtio_notify(VirtIODevice *vdev, VirtQueue *vq);
 
+/**
+ * virtio_queue_should_notify() - check whether the driver wants a notification
+ * @vdev: the VirtIO device
+ * @vq: the virtqueue whose used ring was updated
+ *
+ * For callers that notify the driver through a notifier of their own
+ * instead of virtio_notify().  Like virtio_notify(), this consumes the
+ * event index, so call it once per notification.
+ */
+bool virtio_queue_should_notify(VirtIODevice *vdev, VirtQueue *vq);
+
 int virtio_save(VirtIODevice *vdev, QEMUFile *f);
 
 extern const VMStateInfo virtio_vmstate_info;
@@ -0,0 +1,44 @@
+/*
+ * Userspace TCP receive coalescing
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#ifndef QEMU_NET_GRO_H
+#define QEMU_NET_GRO_H
+
+#include "net/eth.h"
+
+#define NET_GRO_MAX_TCP_PAYLOAD 65535
+
+/* Size of the buffer net_gro_merge() builds a packet in */
+#define NET_GRO_BUF_SIZE(vnet_hdr_len) ((vnet_hdr_len) +                \
+                                        sizeof(struct eth_header) +     \
+                                        sizeof(struct ip6_header) +     \
+                                        NET_GRO_MAX_TCP_PAYLOAD)
+
+/**
+ * net_gro_merge: merge consecutive TCP segments into one GSO packet
+ *
+ * @pkts: packets, each starting with a virtio-net header
+ * @count: number of packets in @pkts
+ * @vnet_hdr_len: length of the virtio-net header
+ * @tcpv4: whether IPv4 segments may be merged
+ * @tcpv6: whether IPv6 segments may be merged
+ * @buf: buffer of NET_GRO_BUF_SIZE(@vnet_hdr_len) bytes
+ * @size: length of the merged packet
+ *
+ * Merges as many in-order segments of one TCP flow from the start of @pkts
+ * as possible into @buf.  Only segments whose virtio-net header carries
+ * exactly VIRTIO_NET_HDR_F_DATA_VALID are merged.  The merged packet gets
+ * a TCPV4 or TCPV6 GSO header; its hdr_len and gso_size fields are in host
+ * byte order, and the TCP checksum is left stale.
+ *
+ * Returns the number of packets merged.  If that is less than two, @buf
+ * and @size are not touched and the first packet should be used as is.
+ */
+int net_gro_merge(const struct iovec *pkts, int count, size_t vnet_hdr_len,
+                  bool tcpv4, bool tcpv6, uint8_t *buf, size_t *size);
+
+#endif
@@ -281,6 +281,13 @@ void qemu_coroutine_inc_pool_size(unsigned int additional_pool_size);
  */
 void qemu_coroutine_dec_pool_size(unsigned int additional_pool_size);
 
+/**
+ * Get the number of coroutines that were taken from a pool (@hits) and the
+ * number that had to be allocated (@misses).  Hits are added up per thread
+ * and published in batches, so they may lag behind slightly.
+ */
+void qemu_coroutine_get_pool_stats(uint64_t *hits, uint64_t *misses);
+
 #include "qemu/lockable.h"
 
 /**
@@ -74,9 +74,20 @@ enum plugin_dyn_cb_type {
 enum plugin_dyn_cb_subtype {
     PLUGIN_CB_REGULAR,
     PLUGIN_CB_INLINE,
+    PLUGIN_CB_COND,
     PLUGIN_N_CB_SUBTYPES,
 };
 
+/*
+ * A scoreboard is an array with one element per vCPU; it is resized (with
+ * all vCPUs stopped and the code cache flushed) when a vCPU is created
+ * whose index does not fit.
+ */
+struct qemu_plugin_scoreboard {
+    GArray *data;
+    QLIST_ENTRY(qemu_plugin_scoreboard) entry;
+};
+
 /*
  * A dynamic callback has an insertion point that is determined at run-time.
  * Usually the insertion point is somewhere in the code cache; think for
@@ -92,11 +103,39 @@ struct qemu_plugin_dyn_cb {
     union {
         struct {
             enum qemu_plugin_op op;
+            /* if @entry.score is NULL, the op applies to @userp instead */
+            qemu_plugin_u64 entry;
             uint64_t imm;
         } inline_insn;
+        struct {
+            enum qemu_plugin_cond cond;
+            qemu_plugin_u64 entry;
+            uint64_t imm;
+        } cond;
     };
 };
 
+/*
+ * Return the address of @entry for vCPU 0, and in @stride the distance
+ * between the entries of consecutive vCPUs.
+ */
+static inline void *plugin_u64_base(qemu_plugin_u64 entry, size_t *stride)
+{
+    *stride = g_array_get_element_size(entry.score->data);
+    return entry.score->data->data + entry.offset;
+}
+
+/* As above, for the target of an inline op */
+static inline void *plugin_inline_op_base(const struct qemu_plugin_dyn_cb *cb,
+                                          size_t *stride)
+{
+    if (!cb->inline_insn.entry.score) {
+        *stride = 0;
+        return cb->userp;
+    }
+    return plugin_u64_base(cb->inline_insn.entry, stride);
+}
+
 /* Internal context for instrumenting an instruction */
 struct qemu_plugin_insn {
     GByteArray *data;
@@ -13,11 +13,14 @@
 
 typedef bool (*qht_cmp_func_t)(const void *a, const void *b);
 
+struct qht_part;
+
 struct qht {
     struct qht_map *map;
     qht_cmp_func_t cmp;
     QemuMutex lock; /* serializes setters of ht->map */
     unsigned int mode;
+    struct qht_part *parts; /* only with QHT_MODE_PARTITIONED */
 };
 
 /**
@@ -48,6 +51,7 @@ typedef bool (*qht_iter_bool_func_t)(void *p, uint32_t h, void *up);
 
 #define QHT_MODE_AUTO_RESIZE 0x1 /* auto-resize when heavily loaded */
 #define QHT_MODE_RAW_MUTEXES 0x2 /* bypass the profiler (QSP) */
+#define QHT_MODE_PARTITIONED 0x4 /* split into independently resized parts */
 
 /**
  * qht_init - Initialize a QHT
@@ -55,6 +59,12 @@ typedef bool (*qht_iter_bool_func_t)(void *p, uint32_t h, void *up);
  * @cmp: default comparison function. Cannot be NULL.
  * @n_elems: number of entries the hash table should be optimized for.
  * @mode: bitmask with OR'ed QHT_MODE_*
+ *
+ * With QHT_MODE_PARTITIONED, the hash table is split into a fixed number of
+ * parts, selected by the hash of each entry.  Each part has its own buckets
+ * and is resized on its own, so that a resize only stops writers to a
+ * fraction of the table.  qht_iter() and qht_reset() then operate on one part
+ * at a time.
  */
 void qht_init(struct qht *ht, qht_cmp_func_t cmp, size_t n_elems,
               unsigned int mode);
@@ -192,4 +192,35 @@ G_DEFINE_AUTOPTR_CLEANUP_FUNC(RCUReadAuto, rcu_read_auto_unlock)
 void rcu_add_force_rcu_notifier(Notifier *n);
 void rcu_remove_force_rcu_notifier(Notifier *n);
 
+/*
+ * Once this many callbacks are pending, the call_rcu thread asks readers
+ * to leave their critical sections, as drain_call_rcu() does, so that
+ * memory is not held for too long.
+ */
+#define RCU_CALL_EXPEDITE_SIZE 1000
+
+#define RCU_GP_LATENCY_BUCKETS 32
+
+typedef struct RCUStats {
+    /* Grace periods completed by synchronize_rcu() */
+    uint64_t grace_periods;
+
+    /* Grace periods in which the call_rcu thread forced quiescent states */
+    uint64_t expedited_grace_periods;
+
+    /* Callbacks passed to call_rcu1() and taken by the call_rcu thread */
+    uint64_t callbacks;
+
+    /* Callbacks waiting now */
+    uint64_t backlog;
+
+    /* Largest batch of callbacks handled after a single grace period */
+    uint64_t max_batch;
+
+    /* log2 histogram of grace period latencies, in nanoseconds */
+    uint64_t gp_latency[RCU_GP_LATENCY_BUCKETS];
+} RCUStats;
+
+void rcu_get_stats(RCUStats *stats);
+
 #endif /* QEMU_RCU_H */
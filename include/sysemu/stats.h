@@ -33,6 +33,18 @@ void add_stats_entry(StatsResultList **, StatsProvider, const char *id,
 void add_stats_schema(StatsSchemaList **, StatsProvider, StatsTarget,
                       StatsSchemaValueList *);
 
+/*
+ * Helper routines for building the lists passed to add_stats_entry() and
+ * add_stats_schema().  Each prepends a new entry to the list and returns the
+ * new head of the list.
+ */
+StatsList *stats_add_scalar(const char *name, uint64_t val,
+                            StatsList *stats_list);
+StatsList *stats_add_histogram(const char *name, const uint64_t *val, int n,
+                               StatsList *stats_list);
+StatsSchemaValueList *stats_schema_add(const char *name, StatsType type,
+                                       StatsSchemaValueList *list);
+
 /*
  * True if a string matches the filter passed to the stats_fn callabck,
  * false otherwise.
@@ -356,6 +356,8 @@ static int query_one_iothread(Object *object, void *opaque)
     info->poll_grow = iothread->poll_grow;
     info->poll_shrink = iothread->poll_shrink;
     info->aio_max_batch = iothread->parent_obj.aio_max_batch;
+    info->poll_hits = stat64_get(&iothread->ctx->poll_stats.poll_hits);
+    info->poll_fd_events = stat64_get(&iothread->ctx->poll_stats.fd_events);
 
     QAPI_LIST_APPEND(*tail, info);
     return 0;
@@ -3091,6 +3091,12 @@ static struct iovec *lock_iovec(int type, abi_ulong target_addr,
 static void unlock_iovec(struct iovec *vec, abi_ulong target_addr,
                          abi_ulong count, int copy)
 {
+    /*
+     * Without DEBUG_REMAP, lock_iovec handed out direct pointers into guest
+     * memory and unlock_user is a no-op: don't validate and walk the guest
+     * iovec array a second time just to copy nothing back.
+     */
+#ifdef DEBUG_REMAP
     struct target_iovec *target_vec;
     int i;
 
@@ -3107,6 +3113,7 @@ static void unlock_iovec(struct iovec *vec, abi_ulong target_addr,
         }
         unlock_user(target_vec, target_addr, 0);
     }
+#endif
 
     g_free(vec);
 }
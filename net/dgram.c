@@ -36,10 +36,18 @@
 #include "qemu/main-loop.h"
 #include "qemu/cutils.h"
 
+#ifdef CONFIG_RECVMMSG
+/* Maximum number of datagrams read by a single recvmmsg() call */
+#define NET_DGRAM_RECV_BATCH 8
+#endif
+
 typedef struct NetDgramState {
     NetClientState nc;
     int fd;
     SocketReadState rs;
+#ifdef CONFIG_RECVMMSG
+    uint8_t recv_buf[NET_DGRAM_RECV_BATCH][NET_BUFSIZE];
+#endif
     bool read_poll;               /* waiting to receive data? */
     bool write_poll;              /* waiting to transmit data? */
     /* contains destination iff connectionless */
@@ -120,6 +128,49 @@ static void net_dgram_rs_finalize(SocketReadState *rs)
     }
 }
 
+#ifdef CONFIG_RECVMMSG
+static void net_dgram_send(void *opaque)
+{
+    NetDgramState *s = opaque;
+    struct mmsghdr msgs[NET_DGRAM_RECV_BATCH] = { 0 };
+    struct iovec iov[NET_DGRAM_RECV_BATCH];
+    struct iovec pkts[NET_DGRAM_RECV_BATCH];
+    int i, count;
+
+    for (i = 0; i < NET_DGRAM_RECV_BATCH; i++) {
+        iov[i].iov_base = s->recv_buf[i];
+        iov[i].iov_len = sizeof(s->recv_buf[i]);
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    count = RETRY_ON_EINTR(recvmmsg(s->fd, msgs, NET_DGRAM_RECV_BATCH,
+                                    MSG_DONTWAIT, NULL));
+    if (count <= 0) {
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        if (msgs[i].msg_len == 0) {
+            break;
+        }
+        pkts[i].iov_base = s->recv_buf[i];
+        pkts[i].iov_len = msgs[i].msg_len;
+    }
+
+    if (i && qemu_send_packets_async(&s->nc, pkts, i,
+                                     net_dgram_send_completed) < i) {
+        net_dgram_read_poll(s, false);
+        return;
+    }
+
+    if (i < count) {
+        /* end of connection */
+        net_dgram_read_poll(s, false);
+        net_dgram_write_poll(s, false);
+    }
+}
+#else
 static void net_dgram_send(void *opaque)
 {
     NetDgramState *s = opaque;
@@ -140,6 +191,7 @@ static void net_dgram_send(void *opaque)
         net_dgram_read_poll(s, false);
     }
 }
+#endif
 
 static int net_dgram_mcast_create(struct sockaddr_in *mcastaddr,
                                   struct in_addr *localaddr,
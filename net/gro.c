@@ -0,0 +1,208 @@
+/*
+ * Userspace TCP receive coalescing
+ *
+ * Consecutive in-order segments of one TCP flow that are received
+ * together are merged into a single GSO packet, so that the guest handles
+ * one packet instead of one per segment.  Nothing is held back across
+ * calls, so this does not add latency.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "net/checksum.h"
+#include "net/gro.h"
+#include "standard-headers/linux/virtio_net.h"
+
+#define NET_GRO_TCP_HDR_LENGTH 0xF000
+
+typedef struct NetGroUnit {
+    uint16_t proto;
+    size_t l3_off;
+    size_t tcp_off;
+    size_t payload_off;
+    size_t payload;
+    uint32_t seq;
+    uint16_t tcp_flags;
+} NetGroUnit;
+
+/* Check that @buf is a plain TCP data segment that may be merged */
+static bool net_gro_parse(const uint8_t *buf, size_t size,
+                          size_t vnet_hdr_len, bool tcpv4, bool tcpv6,
+                          NetGroUnit *unit)
+{
+    const struct virtio_net_hdr *hdr = (const struct virtio_net_hdr *)buf;
+    const struct tcp_header *tcp;
+    size_t tcp_hdrlen;
+
+    unit->l3_off = vnet_hdr_len + sizeof(struct eth_header);
+    if (size < unit->l3_off + sizeof(struct ip6_header) ||
+        hdr->flags != VIRTIO_NET_HDR_F_DATA_VALID ||
+        hdr->gso_type != VIRTIO_NET_HDR_GSO_NONE) {
+        return false;
+    }
+
+    unit->proto = be16_to_cpu(PKT_GET_ETH_HDR(buf + vnet_hdr_len)->h_proto);
+    if (unit->proto == ETH_P_IP) {
+        const struct ip_header *ip =
+            (const struct ip_header *)(buf + unit->l3_off);
+
+        if (!tcpv4 ||
+            ip->ip_ver_len != 0x45 || ip->ip_p != IP_PROTO_TCP ||
+            IP4_IS_FRAGMENT(ip) ||
+            be16_to_cpu(ip->ip_len) != size - unit->l3_off) {
+            return false;
+        }
+        unit->tcp_off = unit->l3_off + sizeof(struct ip_header);
+    } else if (unit->proto == ETH_P_IPV6) {
+        const struct ip6_header *ip6 =
+            (const struct ip6_header *)(buf + unit->l3_off);
+
+        if (!tcpv6 ||
+            (ip6->ip6_ctlun.ip6_un3.ip6_un3_vfc >> 4) != 6 ||
+            ip6->ip6_ctlun.ip6_un1.ip6_un1_nxt != IP_PROTO_TCP ||
+            be16_to_cpu(ip6->ip6_ctlun.ip6_un1.ip6_un1_plen) !=
+            size - unit->l3_off - sizeof(struct ip6_header)) {
+            return false;
+        }
+        unit->tcp_off = unit->l3_off + sizeof(struct ip6_header);
+    } else {
+        return false;
+    }
+
+    if (size < unit->tcp_off + sizeof(struct tcp_header)) {
+        return false;
+    }
+    tcp = (const struct tcp_header *)(buf + unit->tcp_off);
+    tcp_hdrlen = (be16_to_cpu(tcp->th_offset_flags) &
+                  NET_GRO_TCP_HDR_LENGTH) >> 10;
+    unit->tcp_flags = be16_to_cpu(tcp->th_offset_flags) &
+                      ~NET_GRO_TCP_HDR_LENGTH;
+    unit->payload_off = unit->tcp_off + tcp_hdrlen;
+    if (tcp_hdrlen < sizeof(struct tcp_header) ||
+        unit->payload_off >= size ||
+        (unit->tcp_flags & ~TH_PUSH) != TH_ACK) {
+        return false;
+    }
+    unit->payload = size - unit->payload_off;
+    unit->seq = be32_to_cpu(tcp->th_seq);
+
+    return true;
+}
+
+/* Can @next be appended to a merged packet that starts with @head? */
+static bool net_gro_match(const uint8_t *head, const NetGroUnit *h,
+                          const uint8_t *next, const NetGroUnit *u)
+{
+    const struct tcp_header *t1 = (const void *)(head + h->tcp_off);
+    const struct tcp_header *t2 = (const void *)(next + u->tcp_off);
+
+    if (u->proto != h->proto || u->payload_off != h->payload_off ||
+        memcmp(head + h->l3_off - sizeof(struct eth_header),
+               next + u->l3_off - sizeof(struct eth_header),
+               sizeof(struct eth_header))) {
+        return false;
+    }
+
+    if (h->proto == ETH_P_IP) {
+        const struct ip_header *ip1 = (const void *)(head + h->l3_off);
+        const struct ip_header *ip2 = (const void *)(next + u->l3_off);
+
+        if (ip1->ip_tos != ip2->ip_tos || ip1->ip_off != ip2->ip_off ||
+            ip1->ip_ttl != ip2->ip_ttl || ip1->ip_src != ip2->ip_src ||
+            ip1->ip_dst != ip2->ip_dst) {
+            return false;
+        }
+    } else {
+        const uint8_t *ip1 = head + h->l3_off;
+        const uint8_t *ip2 = next + u->l3_off;
+
+        /* everything but the payload length */
+        if (memcmp(ip1, ip2, 4) ||
+            memcmp(ip1 + 6, ip2 + 6, sizeof(struct ip6_header) - 6)) {
+            return false;
+        }
+    }
+
+    return t1->th_sport == t2->th_sport && t1->th_dport == t2->th_dport &&
+           t1->th_ack == t2->th_ack && t1->th_win == t2->th_win &&
+           t1->th_urp == t2->th_urp &&
+           !memcmp(t1 + 1, t2 + 1,
+                   h->payload_off - h->tcp_off - sizeof(struct tcp_header));
+}
+
+int net_gro_merge(const struct iovec *pkts, int count, size_t vnet_hdr_len,
+                  bool tcpv4, bool tcpv6, uint8_t *buf, size_t *size)
+{
+    NetGroUnit head, prev, unit;
+    struct virtio_net_hdr *hdr;
+    size_t len, l3_max, gso_size;
+    int i;
+
+    if (count < 2 || !net_gro_parse(pkts[0].iov_base, pkts[0].iov_len,
+                                    vnet_hdr_len, tcpv4, tcpv6, &head)) {
+        return 1;
+    }
+
+    gso_size = head.payload;
+    l3_max = head.l3_off + NET_GRO_MAX_TCP_PAYLOAD +
+             (head.proto == ETH_P_IPV6 ? sizeof(struct ip6_header) : 0);
+    prev = head;
+    len = pkts[0].iov_len;
+
+    for (i = 1; i < count; i++) {
+        if ((prev.tcp_flags & TH_PUSH) || prev.payload != gso_size ||
+            !net_gro_parse(pkts[i].iov_base, pkts[i].iov_len,
+                           vnet_hdr_len, tcpv4, tcpv6, &unit) ||
+            unit.seq != prev.seq + prev.payload ||
+            unit.payload > gso_size || len + unit.payload > l3_max ||
+            !net_gro_match(pkts[0].iov_base, &head,
+                           pkts[i].iov_base, &unit)) {
+            break;
+        }
+
+        if (i == 1) {
+            memcpy(buf, pkts[0].iov_base, pkts[0].iov_len);
+        }
+        memcpy(buf + len,
+               (uint8_t *)pkts[i].iov_base + unit.payload_off, unit.payload);
+        len += unit.payload;
+        prev = unit;
+    }
+
+    if (i < 2) {
+        return 1;
+    }
+
+    /* the merged packet carries the PSH of its last segment */
+    if (prev.tcp_flags & TH_PUSH) {
+        struct tcp_header *tcp = (struct tcp_header *)(buf + head.tcp_off);
+        tcp->th_offset_flags |= cpu_to_be16(TH_PUSH);
+    }
+
+    if (head.proto == ETH_P_IP) {
+        struct ip_header *ip = (struct ip_header *)(buf + head.l3_off);
+        ip->ip_len = cpu_to_be16(len - head.l3_off);
+        ip->ip_sum = 0;
+        ip->ip_sum = cpu_to_be16(net_raw_checksum((uint8_t *)ip,
+                                                  sizeof(*ip)));
+    } else {
+        struct ip6_header *ip6 = (struct ip6_header *)(buf + head.l3_off);
+        ip6->ip6_ctlun.ip6_un1.ip6_un1_plen =
+            cpu_to_be16(len - head.l3_off - sizeof(*ip6));
+    }
+
+    /* The segments were validated, so the stale TCP checksum is fine */
+    hdr = (struct virtio_net_hdr *)buf;
+    hdr->flags = VIRTIO_NET_HDR_F_DATA_VALID;
+    hdr->gso_type = head.proto == ETH_P_IP ? VIRTIO_NET_HDR_GSO_TCPV4 :
+                                             VIRTIO_NET_HDR_GSO_TCPV6;
+    hdr->hdr_len = head.payload_off - vnet_hdr_len;
+    hdr->gso_size = gso_size;
+    hdr->csum_start = 0;
+    hdr->csum_offset = 0;
+
+    *size = len;
+    return i;
+}
@@ -253,6 +253,11 @@ static ssize_t qemu_deliver_packet_iov(NetClientState *sender,
                                        const struct iovec *iov,
                                        int iovcnt,
                                        void *opaque);
+static int qemu_deliver_packet_batch(NetClientState *sender,
+                                     unsigned flags,
+                                     const struct iovec *pkts,
+                                     int count,
+                                     void *opaque);
 
 static void qemu_net_client_setup(NetClientState *nc,
                                   NetClientInfo *info,
@@ -278,6 +283,10 @@ static void qemu_net_client_setup(NetClientState *nc,
     QTAILQ_INSERT_TAIL(&net_clients, nc, next);
 
     nc->incoming_queue = qemu_new_net_queue(qemu_deliver_packet_iov, nc);
+    if (info->receive_batch) {
+        qemu_net_queue_set_deliver_batch(nc->incoming_queue,
+                                         qemu_deliver_packet_batch);
+    }
     nc->destructor = destructor;
     nc->is_datapath = is_datapath;
     QTAILQ_INIT(&nc->filters);
@@ -737,6 +746,40 @@ ssize_t qemu_send_packet_async(NetClientState *sender,
                                              buf, size, sent_cb);
 }
 
+/*
+ * Send several packets at once.  Returns the number of packets that were
+ * consumed; if that is less than @count, the other packets have been
+ * queued and @sent_cb will be called for each of them, just like when
+ * qemu_send_packet_async() returns 0.
+ */
+int qemu_send_packets_async(NetClientState *sender,
+                            const struct iovec *pkts, int count,
+                            NetPacketSent *sent_cb)
+{
+    int i, done = count;
+
+    if (sender->link_down || !sender->peer) {
+        return count;
+    }
+
+    /* Filters and peers without a batch hook take packets one by one */
+    if (!sender->peer->info->receive_batch ||
+        !QTAILQ_EMPTY(&sender->filters) ||
+        !QTAILQ_EMPTY(&sender->peer->filters)) {
+        for (i = 0; i < count; i++) {
+            if (qemu_send_packet_async(sender, pkts[i].iov_base,
+                                       pkts[i].iov_len, sent_cb) == 0) {
+                done--;
+            }
+        }
+        return done;
+    }
+
+    return qemu_net_queue_send_batch(sender->peer->incoming_queue, sender,
+                                     QEMU_NET_PACKET_FLAG_NONE, pkts, count,
+                                     sent_cb);
+}
+
 ssize_t qemu_send_packet(NetClientState *nc, const uint8_t *buf, int size)
 {
     return qemu_send_packet_async(nc, buf, size, NULL);
@@ -829,6 +872,40 @@ static ssize_t qemu_deliver_packet_iov(NetClientState *sender,
     return ret;
 }
 
+static int qemu_deliver_packet_batch(NetClientState *sender,
+                                     unsigned flags,
+                                     const struct iovec *pkts,
+                                     int count,
+                                     void *opaque)
+{
+    NetClientState *nc = opaque;
+    int i;
+
+    if (nc->link_down) {
+        return count;
+    }
+
+    if (nc->receive_disabled) {
+        return 0;
+    }
+
+    if (flags & QEMU_NET_PACKET_FLAG_RAW) {
+        for (i = 0; i < count; i++) {
+            if (qemu_deliver_packet_iov(sender, flags, &pkts[i], 1, nc) == 0) {
+                break;
+            }
+        }
+        return i;
+    }
+
+    i = nc->info->receive_batch(nc, pkts, count);
+    if (i < count) {
+        nc->receive_disabled = 1;
+    }
+
+    return i;
+}
+
 ssize_t qemu_sendv_packet_async(NetClientState *sender,
                                 const struct iovec *iov, int iovcnt,
                                 NetPacketSent *sent_cb)
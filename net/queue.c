@@ -40,6 +40,9 @@
  * unbounded queueing.
  */
 
+/* Maximum number of packets handed to a batch delivery function at once */
+#define NET_QUEUE_FLUSH_BATCH 64
+
 struct NetPacket {
     QTAILQ_ENTRY(NetPacket) entry;
     NetClientState *sender;
@@ -54,6 +57,7 @@ struct NetQueue {
     uint32_t nq_maxlen;
     uint32_t nq_count;
     NetQueueDeliverFunc *deliver;
+    NetQueueDeliverBatchFunc *deliver_batch;
 
     QTAILQ_HEAD(, NetPacket) packets;
 
@@ -78,6 +82,12 @@ NetQueue *qemu_new_net_queue(NetQueueDeliverFunc *deliver, void *opaque)
     return queue;
 }
 
+void qemu_net_queue_set_deliver_batch(NetQueue *queue,
+                                      NetQueueDeliverBatchFunc *deliver_batch)
+{
+    queue->deliver_batch = deliver_batch;
+}
+
 void qemu_del_net_queue(NetQueue *queue)
 {
     NetPacket *packet, *next;
@@ -254,6 +264,42 @@ ssize_t qemu_net_queue_send_iov(NetQueue *queue,
     return ret;
 }
 
+/*
+ * Send @count packets, each contiguous in one element of @pkts, with a
+ * single call to the batch delivery function.  Returns the number of
+ * packets that were consumed; the others are queued and @sent_cb is
+ * called for each of them once it has been delivered.
+ */
+int qemu_net_queue_send_batch(NetQueue *queue,
+                              NetClientState *sender,
+                              unsigned flags,
+                              const struct iovec *pkts,
+                              int count,
+                              NetPacketSent *sent_cb)
+{
+    int i, done = 0;
+
+    assert(queue->deliver_batch);
+
+    if (!queue->delivering && qemu_can_send_packet(sender)) {
+        queue->delivering = 1;
+        done = queue->deliver_batch(sender, flags, pkts, count,
+                                    queue->opaque);
+        queue->delivering = 0;
+    }
+
+    for (i = done; i < count; i++) {
+        qemu_net_queue_append(queue, sender, flags, pkts[i].iov_base,
+                              pkts[i].iov_len, sent_cb);
+    }
+
+    if (done == count) {
+        qemu_net_queue_flush(queue);
+    }
+
+    return done;
+}
+
 void qemu_net_queue_purge(NetQueue *queue, NetClientState *from)
 {
     NetPacket *packet, *next;
@@ -270,6 +316,52 @@ void qemu_net_queue_purge(NetQueue *queue, NetClientState *from)
     }
 }
 
+/*
+ * Hand a run of queued packets with the same sender and flags to the
+ * batch delivery function.  Returns false if the receiver did not take
+ * all of them.
+ */
+static bool qemu_net_queue_flush_batch(NetQueue *queue)
+{
+    NetPacket *batch[NET_QUEUE_FLUSH_BATCH];
+    struct iovec pkts[NET_QUEUE_FLUSH_BATCH];
+    NetPacket *packet;
+    int i, count = 0, done;
+
+    while (count < NET_QUEUE_FLUSH_BATCH) {
+        packet = QTAILQ_FIRST(&queue->packets);
+        if (!packet || (count && (packet->sender != batch[0]->sender ||
+                                  packet->flags != batch[0]->flags))) {
+            break;
+        }
+        QTAILQ_REMOVE(&queue->packets, packet, entry);
+        queue->nq_count--;
+        batch[count] = packet;
+        pkts[count].iov_base = packet->data;
+        pkts[count].iov_len = packet->size;
+        count++;
+    }
+
+    queue->delivering = 1;
+    done = queue->deliver_batch(batch[0]->sender, batch[0]->flags,
+                                pkts, count, queue->opaque);
+    queue->delivering = 0;
+
+    for (i = count - 1; i >= done; i--) {
+        queue->nq_count++;
+        QTAILQ_INSERT_HEAD(&queue->packets, batch[i], entry);
+    }
+
+    for (i = 0; i < done; i++) {
+        if (batch[i]->sent_cb) {
+            batch[i]->sent_cb(batch[i]->sender, batch[i]->size);
+        }
+        g_free(batch[i]);
+    }
+
+    return done == count;
+}
+
 bool qemu_net_queue_flush(NetQueue *queue)
 {
     if (queue->delivering)
@@ -279,6 +371,13 @@ bool qemu_net_queue_flush(NetQueue *queue)
         NetPacket *packet;
         int ret;
 
+        if (queue->deliver_batch) {
+            if (!qemu_net_queue_flush_batch(queue)) {
+                return false;
+            }
+            continue;
+        }
+
         packet = QTAILQ_FIRST(&queue->packets);
         QTAILQ_REMOVE(&queue->packets, packet, entry);
         queue->nq_count--;
@@ -47,12 +47,19 @@
 
 #include "net/vhost_net.h"
 
+/*
+ * tap_send() reads packets back to back into TAPState.buf, as long as one
+ * of the maximum size still fits, and passes them to the peer together.
+ */
+#define TAP_SEND_BATCH      32
+#define TAP_SEND_BUF_SIZE   (4 * NET_BUFSIZE)
+
 typedef struct TAPState {
     NetClientState nc;
     int fd;
     char down_script[1024];
     char down_script_arg[128];
-    uint8_t buf[NET_BUFSIZE];
+    uint8_t buf[TAP_SEND_BUF_SIZE];
     bool read_poll;
     bool write_poll;
     bool using_vnet_hdr;
@@ -182,49 +189,62 @@ static void tap_send_completed(NetClientState *nc, ssize_t len)
 static void tap_send(void *opaque)
 {
     TAPState *s = opaque;
-    int size;
+    uint8_t min_pkt[TAP_SEND_BATCH][ETH_ZLEN];
+    struct iovec pkts[TAP_SEND_BATCH];
+    bool empty = false;
     int packets = 0;
 
-    while (true) {
-        uint8_t *buf = s->buf;
-        uint8_t min_pkt[ETH_ZLEN];
-        size_t min_pktsz = sizeof(min_pkt);
-
-        size = tap_read_packet(s->fd, s->buf, sizeof(s->buf));
-        if (size <= 0) {
-            break;
-        }
+    /*
+     * When the host keeps receiving more packets while tap_send() is
+     * running we can hog the QEMU global mutex.  Limit the number of
+     * packets that are processed per tap_send() callback to prevent
+     * stalling the guest.
+     */
+    while (packets < 50 && !empty) {
+        int max = MIN(TAP_SEND_BATCH, 50 - packets);
+        size_t offset = 0;
+        int count = 0;
+
+        while (count < max && offset + NET_BUFSIZE <= sizeof(s->buf)) {
+            uint8_t *buf = s->buf + offset;
+            size_t min_pktsz = ETH_ZLEN;
+            int size;
+
+            size = tap_read_packet(s->fd, buf, NET_BUFSIZE);
+            if (size <= 0) {
+                empty = true;
+                break;
+            }
+            offset += size;
 
-        if (s->host_vnet_hdr_len && !s->using_vnet_hdr) {
-            buf  += s->host_vnet_hdr_len;
-            size -= s->host_vnet_hdr_len;
-        }
+            if (s->host_vnet_hdr_len && !s->using_vnet_hdr) {
+                buf  += s->host_vnet_hdr_len;
+                size -= s->host_vnet_hdr_len;
+            }
 
-        if (net_peer_needs_padding(&s->nc)) {
-            if (eth_pad_short_frame(min_pkt, &min_pktsz, buf, size)) {
-                buf = min_pkt;
-                size = min_pktsz;
+            if (net_peer_needs_padding(&s->nc)) {
+                if (eth_pad_short_frame(min_pkt[count], &min_pktsz,
+                                        buf, size)) {
+                    buf = min_pkt[count];
+                    size = min_pktsz;
+                }
             }
+
+            pkts[count].iov_base = buf;
+            pkts[count].iov_len = size;
+            count++;
         }
 
-        size = qemu_send_packet_async(&s->nc, buf, size, tap_send_completed);
-        if (size == 0) {
-            tap_read_poll(s, false);
-            break;
-        } else if (size < 0) {
+        if (count == 0) {
             break;
         }
 
-        /*
-         * When the host keeps receiving more packets while tap_send() is
-         * running we can hog the QEMU global mutex.  Limit the number of
-         * packets that are processed per tap_send() callback to prevent
-         * stalling the guest.
-         */
-        packets++;
-        if (packets >= 50) {
+        if (qemu_send_packets_async(&s->nc, pkts, count,
+                                    tap_send_completed) < count) {
+            tap_read_poll(s, false);
             break;
         }
+        packets += count;
     }
 }
 
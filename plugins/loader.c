@@ -300,6 +300,14 @@ int qemu_plugin_load_list(QemuPluginList *head, Error **errp)
     info->system_emulation = true;
     info->system.smp_vcpus = ms->smp.cpus;
     info->system.max_vcpus = ms->smp.max_cpus;
+    /*
+     * Size scoreboards for every possible vCPU up front, so hotplugged
+     * vCPUs never need them to be resized.
+     */
+    qemu_rec_mutex_lock(&plugin.lock);
+    plugin.scoreboard_alloc_size = MAX(plugin.scoreboard_alloc_size,
+                                       ms->smp.max_cpus);
+    qemu_rec_mutex_unlock(&plugin.lock);
 #else
     info->system_emulation = false;
 #endif
@@ -183,7 +183,9 @@ DEF("accel", HAS_ARG, QEMU_OPTION_accel,
     "                kernel-irqchip=on|off|split controls accelerated irqchip support (default=on)\n"
     "                kvm-shadow-mem=size of KVM shadow MMU in bytes\n"
     "                split-wx=on|off (enable TCG split w^x mapping)\n"
+    "                large-page-fill=on|off (refill TCG tlb from cached large page translations)\n"
     "                tb-size=n (TCG translation block cache size)\n"
+    "                tb-htable-partitioned=on|off (split the TCG translation block hash table)\n"
     "                dirty-ring-size=n (KVM dirty ring GFN count, default 0)\n"
     "                notify-vmexit=run|internal-error|disable,notify-window=n (enable notify VM exit and set notify window, x86 only)\n"
     "                thread=single|multi (enable multi-threaded TCG)\n", QEMU_ARCH_ALL)
@@ -210,6 +212,14 @@ SRST
     ``kvm-shadow-mem=size``
         Defines the size of the KVM shadow MMU.
 
+    ``large-page-fill=on|off``
+        Controls whether the TCG softmmu tlb remembers the most recent
+        large page translation for each MMU mode, and refills misses on
+        other pages within that large page directly from it rather than
+        walking the guest page tables again. This benefits memory-bound
+        guests whose kernel maps RAM linearly with huge pages. The
+        default is off.
+
     ``split-wx=on|off``
         Controls the use of split w^x mapping for the TCG code generation
         buffer. Some operating systems require this to be enabled, and in
@@ -219,6 +229,13 @@ SRST
     ``tb-size=n``
         Controls the size (in MiB) of the TCG translation block cache.
 
+    ``tb-htable-partitioned=on|off``
+        Controls whether the hash table that TCG uses to look up
+        translation blocks is split into parts that are resized
+        independently. With many vCPUs translating code at the same
+        time, this keeps a resize from stalling every vCPU that inserts
+        into the table. The default is off.
+
     ``thread=single|multi``
         Controls number of TCG threads. When the TCG is multi-threaded
         there will be one thread per vCPU therefore taking advantage of
@@ -49,6 +49,20 @@ static QTAILQ_HEAD(, AddressSpace) address_spaces
     = QTAILQ_HEAD_INITIALIZER(address_spaces);
 
 static GHashTable *flat_views;
+unsigned flatview_generation;
+
+/*
+ * Parts of the memory map that changed since the last commit, as a list
+ * of AddrRanges for each MemoryRegion.  A range is relative to where the
+ * region itself is placed, i.e. it covers mr->addr + range.start onwards
+ * in the region's container.  The next commit only re-renders the parts
+ * of each FlatView that these ranges end up in.
+ */
+#define FLATVIEW_DIRTY_MAX 64
+
+static GHashTable *flatview_dirty;
+static unsigned flatview_dirty_nr;
+static bool flatview_dirty_all;
 
 typedef struct AddrRange AddrRange;
 
@@ -349,6 +363,80 @@ static void flatview_simplify(FlatView *view)
     }
 }
 
+/* Return the index of the first range in @view that ends after @addr.  */
+static unsigned flatview_lookup_index(FlatView *view, Int128 addr)
+{
+    unsigned lo = 0, hi = view->nr;
+
+    while (lo < hi) {
+        unsigned mid = lo + (hi - lo) / 2;
+
+        if (int128_ge(addr, addrrange_end(view->ranges[mid].addr))) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void flatview_mark_all_dirty(void)
+{
+    flatview_dirty_all = true;
+}
+
+/*
+ * Record that [@start, @start + @size) changed in the coordinates of @mr.
+ * Once too many changes pile up in a transaction, just render everything.
+ */
+static void flatview_mark_dirty(MemoryRegion *mr, Int128 start, Int128 size)
+{
+    AddrRange range = addrrange_make(start, size);
+    GArray *ranges;
+
+    if (flatview_dirty_all) {
+        return;
+    }
+    if (++flatview_dirty_nr > FLATVIEW_DIRTY_MAX) {
+        flatview_mark_all_dirty();
+        return;
+    }
+
+    if (!flatview_dirty) {
+        flatview_dirty = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                               NULL,
+                                               (GDestroyNotify) g_array_unref);
+    }
+    ranges = g_hash_table_lookup(flatview_dirty, mr);
+    if (!ranges) {
+        ranges = g_array_new(false, false, sizeof(AddrRange));
+        g_hash_table_insert(flatview_dirty, mr, ranges);
+    }
+    g_array_append_val(ranges, range);
+}
+
+/* The whole extent of @mr changed, e.g. its attributes or its size.  */
+static void memory_region_mark_dirty(MemoryRegion *mr)
+{
+    flatview_mark_dirty(mr, int128_zero(), mr->size);
+}
+
+/* @subregion is being added to or removed from @mr.  */
+static void memory_region_mark_subregion_dirty(MemoryRegion *mr,
+                                               MemoryRegion *subregion)
+{
+    flatview_mark_dirty(mr, int128_make64(subregion->addr), subregion->size);
+}
+
+static void flatview_dirty_reset(void)
+{
+    if (flatview_dirty) {
+        g_hash_table_remove_all(flatview_dirty);
+    }
+    flatview_dirty_nr = 0;
+    flatview_dirty_all = false;
+}
+
 static bool memory_region_big_endian(MemoryRegion *mr)
 {
 #if TARGET_BIG_ENDIAN
@@ -542,6 +630,11 @@ static MemTxResult access_with_adjusted_size(hwaddr addr,
         access_size_max = 4;
     }
 
+    if (likely(size >= access_size_min && size <= access_size_max)) {
+        return access_fn(mr, addr, value, size, 0,
+                         MAKE_64BIT_MASK(0, size * 8), attrs);
+    }
+
     /* FIXME: support unaligned access? */
     access_size = MAX(MIN(size, access_size_max), access_size_min);
     access_mask = MAKE_64BIT_MASK(0, access_size * 8);
@@ -637,7 +730,8 @@ static void render_memory_region(FlatView *view,
     fr.nonvolatile = nonvolatile;
 
     /* Render the region itself into any gaps left by the current view. */
-    for (i = 0; i < view->nr && int128_nz(remain); ++i) {
+    for (i = flatview_lookup_index(view, base);
+         i < view->nr && int128_nz(remain); ++i) {
         if (int128_ge(base, addrrange_end(view->ranges[i].addr))) {
             continue;
         }
@@ -725,10 +819,26 @@ static MemoryRegion *memory_region_get_flatview_root(MemoryRegion *mr)
     return NULL;
 }
 
+/* Simplify a freshly rendered view, build its dispatch and publish it. */
+static void flatview_finish(FlatView *view)
+{
+    int i;
+
+    flatview_simplify(view);
+
+    view->dispatch = address_space_dispatch_new(view);
+    for (i = 0; i < view->nr; i++) {
+        MemoryRegionSection mrs =
+            section_from_flat_range(&view->ranges[i], view);
+        flatview_add_to_dispatch(view, &mrs);
+    }
+    address_space_dispatch_compact(view->dispatch);
+    g_hash_table_replace(flat_views, view->root, view);
+}
+
 /* Render a memory topology into a list of disjoint absolute ranges. */
 static FlatView *generate_memory_topology(MemoryRegion *mr)
 {
-    int i;
     FlatView *view;
 
     view = flatview_new(mr);
@@ -738,16 +848,145 @@ static FlatView *generate_memory_topology(MemoryRegion *mr)
                              addrrange_make(int128_zero(), int128_2_64()),
                              false, false);
     }
-    flatview_simplify(view);
+    flatview_finish(view);
 
-    view->dispatch = address_space_dispatch_new(view);
-    for (i = 0; i < view->nr; i++) {
-        MemoryRegionSection mrs =
-            section_from_flat_range(&view->ranges[i], view);
-        flatview_add_to_dispatch(view, &mrs);
+    return view;
+}
+
+/*
+ * Find out where the dirty ranges end up in the view of @mr, walking the
+ * tree the same way as render_memory_region().  The ranges of a region
+ * are clipped by its container but not by the region itself, so that a
+ * region that shrank or was disabled still invalidates its old extent.
+ */
+static void flatview_collect_dirty(GArray *windows, MemoryRegion *mr,
+                                   Int128 base, AddrRange clip)
+{
+    MemoryRegion *subregion;
+    GArray *ranges;
+    AddrRange tmp;
+    unsigned i;
+
+    int128_addto(&base, int128_make64(mr->addr));
+
+    ranges = g_hash_table_lookup(flatview_dirty, mr);
+    for (i = 0; ranges && i < ranges->len; i++) {
+        tmp = g_array_index(ranges, AddrRange, i);
+        int128_addto(&tmp.start, base);
+        if (addrrange_intersects(tmp, clip)) {
+            tmp = addrrange_intersection(tmp, clip);
+            g_array_append_val(windows, tmp);
+        }
     }
-    address_space_dispatch_compact(view->dispatch);
-    g_hash_table_replace(flat_views, mr, view);
+
+    if (!mr->enabled) {
+        return;
+    }
+
+    tmp = addrrange_make(base, mr->size);
+    if (!addrrange_intersects(tmp, clip)) {
+        return;
+    }
+    clip = addrrange_intersection(tmp, clip);
+
+    if (mr->alias) {
+        int128_subfrom(&base, int128_make64(mr->alias->addr));
+        int128_subfrom(&base, int128_make64(mr->alias_offset));
+        flatview_collect_dirty(windows, mr->alias, base, clip);
+        return;
+    }
+
+    QTAILQ_FOREACH(subregion, &mr->subregions, subregions_link) {
+        flatview_collect_dirty(windows, subregion, base, clip);
+    }
+}
+
+static gint addrrange_compare(gconstpointer a, gconstpointer b)
+{
+    const AddrRange *r1 = a, *r2 = b;
+
+    if (int128_lt(r1->start, r2->start)) {
+        return -1;
+    }
+    return int128_gt(r1->start, r2->start);
+}
+
+/* Sort @windows and merge the ones that overlap or touch. */
+static void addrrange_array_merge(GArray *windows)
+{
+    AddrRange *r = (AddrRange *)windows->data;
+    unsigned i, n = 0;
+
+    g_array_sort(windows, addrrange_compare);
+    for (i = 0; i < windows->len; i++) {
+        if (n && int128_le(r[i].start, addrrange_end(r[n - 1]))) {
+            Int128 end = int128_max(addrrange_end(r[n - 1]),
+                                    addrrange_end(r[i]));
+            r[n - 1].size = int128_sub(end, r[n - 1].start);
+        } else {
+            r[n++] = r[i];
+        }
+    }
+    g_array_set_size(windows, n);
+}
+
+/* Append the parts of @old's ranges that lie in [@start, @end) to @view. */
+static void flatview_copy_ranges(FlatView *view, FlatView *old,
+                                 Int128 start, Int128 end)
+{
+    unsigned i;
+
+    for (i = flatview_lookup_index(old, start);
+         i < old->nr && int128_lt(old->ranges[i].addr.start, end); i++) {
+        FlatRange fr = old->ranges[i];
+        Int128 fr_end = addrrange_end(fr.addr);
+
+        if (int128_lt(fr.addr.start, start)) {
+            fr.offset_in_region +=
+                int128_get64(int128_sub(start, fr.addr.start));
+            fr.addr.start = start;
+        }
+        fr.addr.size = int128_sub(int128_min(fr_end, end), fr.addr.start);
+        flatview_insert(view, view->nr, &fr);
+    }
+}
+
+/*
+ * Update the view of @mr after a transaction, starting from the view
+ * @old it had at the previous commit.  Only the parts of the address
+ * space that were touched by the transaction are rendered again, the
+ * rest is copied over; if nothing visible changed, @old is kept as is
+ * and its listeners are not bothered at all.
+ */
+static FlatView *flatview_update(FlatView *old, MemoryRegion *mr)
+{
+    g_autoptr(GArray) windows = g_array_new(false, false, sizeof(AddrRange));
+    Int128 start = int128_zero();
+    FlatView *view;
+    unsigned i;
+
+    flatview_collect_dirty(windows, mr, int128_zero(),
+                           addrrange_make(int128_zero(), int128_2_64()));
+    if (!windows->len) {
+        flatview_ref(old);
+        g_hash_table_replace(flat_views, mr, old);
+        return old;
+    }
+    if (windows->len > FLATVIEW_DIRTY_MAX) {
+        return generate_memory_topology(mr);
+    }
+    addrrange_array_merge(windows);
+
+    view = flatview_new(mr);
+    for (i = 0; i < windows->len; i++) {
+        AddrRange window = g_array_index(windows, AddrRange, i);
+
+        flatview_copy_ranges(view, old, start, window.start);
+        render_memory_region(view, mr, int128_zero(), window, false, false);
+        start = addrrange_end(window);
+    }
+    flatview_copy_ranges(view, old, start, int128_2_64());
+    flatview_finish(view);
 
     return view;
 }
@@ -1004,23 +1243,32 @@ static void flatviews_init(void)
 
 static void flatviews_reset(void)
 {
+    GHashTable *old_views = flat_views;
+    bool incremental = old_views && !flatview_dirty_all && flatview_dirty_nr;
     AddressSpace *as;
 
-    if (flat_views) {
-        g_hash_table_unref(flat_views);
-        flat_views = NULL;
-    }
+    flat_views = NULL;
     flatviews_init();
 
     /* Render unique FVs */
     QTAILQ_FOREACH(as, &address_spaces, address_spaces_link) {
         MemoryRegion *physmr = memory_region_get_flatview_root(as->root);
+        FlatView *old_view;
 
         if (g_hash_table_lookup(flat_views, physmr)) {
             continue;
         }
 
-        generate_memory_topology(physmr);
+        old_view = incremental ? g_hash_table_lookup(old_views, physmr) : NULL;
+        if (old_view) {
+            flatview_update(old_view, physmr);
+        } else {
+            generate_memory_topology(physmr);
+        }
+    }
+
+    if (old_views) {
+        g_hash_table_unref(old_views);
     }
 }
 
@@ -1054,6 +1302,7 @@ static void address_space_set_flatview(AddressSpace *as)
 
     /* Writes are protected by the BQL.  */
     qatomic_rcu_set(&as->current_map, new_view);
+    qatomic_store_release(&flatview_generation, flatview_generation + 1);
     if (old_view) {
         flatview_unref(old_view);
     }
@@ -1113,6 +1362,7 @@ void memory_region_transaction_commit(void)
             }
             ioeventfd_update_pending = false;
         }
+        flatview_dirty_reset();
    }
 }
 
@@ -2220,6 +2470,7 @@ void memory_region_set_log(MemoryRegion *mr, bool log, unsigned client)
 
     memory_region_transaction_begin();
     mr->dirty_log_mask = (mr->dirty_log_mask & ~mask) | (log * mask);
+    memory_region_mark_dirty(mr);
     memory_region_update_pending |= mr->enabled;
     memory_region_transaction_commit();
 }
@@ -2350,6 +2601,7 @@ void memory_region_set_readonly(MemoryRegion *mr, bool readonly)
     if (mr->readonly != readonly) {
         memory_region_transaction_begin();
         mr->readonly = readonly;
+        memory_region_mark_dirty(mr);
         memory_region_update_pending |= mr->enabled;
         memory_region_transaction_commit();
     }
@@ -2360,6 +2612,7 @@ void memory_region_set_nonvolatile(MemoryRegion *mr, bool nonvolatile)
     if (mr->nonvolatile != nonvolatile) {
         memory_region_transaction_begin();
         mr->nonvolatile = nonvolatile;
+        memory_region_mark_dirty(mr);
         memory_region_update_pending |= mr->enabled;
         memory_region_transaction_commit();
     }
@@ -2370,6 +2623,7 @@ void memory_region_rom_device_set_romd(MemoryRegion *mr, bool romd_mode)
     if (mr->romd_mode != romd_mode) {
         memory_region_transaction_begin();
         mr->romd_mode = romd_mode;
+        memory_region_mark_dirty(mr);
         memory_region_update_pending |= mr->enabled;
         memory_region_transaction_commit();
     }
@@ -2615,6 +2869,7 @@ static void memory_region_update_container_subregions(MemoryRegion *subregion)
     }
     QTAILQ_INSERT_TAIL(&mr->subregions, subregion, subregions_link);
 done:
+    memory_region_mark_subregion_dirty(mr, subregion);
     memory_region_update_pending |= mr->enabled && subregion->enabled;
     memory_region_transaction_commit();
 }
@@ -2664,6 +2919,7 @@ void memory_region_del_subregion(MemoryRegion *mr,
         assert(alias->mapped_via_alias >= 0);
     }
     QTAILQ_REMOVE(&mr->subregions, subregion, subregions_link);
+    memory_region_mark_subregion_dirty(mr, subregion);
     memory_region_unref(subregion);
     memory_region_update_pending |= mr->enabled && subregion->enabled;
     memory_region_transaction_commit();
@@ -2676,6 +2932,7 @@ void memory_region_set_enabled(MemoryRegion *mr, bool enabled)
     }
     memory_region_transaction_begin();
     mr->enabled = enabled;
+    memory_region_mark_dirty(mr);
     memory_region_update_pending = true;
     memory_region_transaction_commit();
 }
@@ -2691,7 +2948,9 @@ void memory_region_set_size(MemoryRegion *mr, uint64_t size)
         return;
     }
     memory_region_transaction_begin();
+    memory_region_mark_dirty(mr);
     mr->size = s;
+    memory_region_mark_dirty(mr);
     memory_region_update_pending = true;
     memory_region_transaction_commit();
 }
@@ -2713,6 +2972,10 @@ static void memory_region_readd_subregion(MemoryRegion *mr)
 void memory_region_set_address(MemoryRegion *mr, hwaddr addr)
 {
     if (addr != mr->addr) {
+        if (mr->container) {
+            /* The old location; the new one is marked when re-adding.  */
+            memory_region_mark_subregion_dirty(mr->container, mr);
+        }
         mr->addr = addr;
         memory_region_readd_subregion(mr);
     }
@@ -2728,6 +2991,7 @@ void memory_region_set_alias_offset(MemoryRegion *mr, hwaddr offset)
 
     memory_region_transaction_begin();
     mr->alias_offset = offset;
+    memory_region_mark_dirty(mr);
     memory_region_update_pending |= mr->enabled;
     memory_region_transaction_commit();
 }
@@ -2899,6 +3163,7 @@ void memory_global_dirty_log_start(unsigned int flags)
     if (!old_flags) {
         MEMORY_LISTENER_CALL_GLOBAL(log_global_start, Forward);
         memory_region_transaction_begin();
+        flatview_mark_all_dirty();
         memory_region_update_pending = true;
         memory_region_transaction_commit();
     }
@@ -2914,6 +3179,7 @@ static void memory_global_dirty_log_do_stop(unsigned int flags)
 
     if (!global_dirty_tracking) {
         memory_region_transaction_begin();
+        flatview_mark_all_dirty();
         memory_region_update_pending = true;
         memory_region_transaction_commit();
         MEMORY_LISTENER_CALL_GLOBAL(log_global_stop, Reverse);
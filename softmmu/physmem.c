@@ -2792,6 +2792,106 @@ MemTxResult address_space_rw(AddressSpace *as, hwaddr addr, MemTxAttrs attrs,
     }
 }
 
+/* Called from RCU critical section.  */
+static MMIODispatchCacheEntry *
+mmio_dispatch_cache_fill(AddressSpace *as, MMIODispatchCache *cache,
+                         unsigned generation, hwaddr addr, bool is_write,
+                         MemTxAttrs attrs)
+{
+    FlatView *fv = address_space_to_flatview(as);
+    MMIODispatchCacheEntry *entry;
+    MemoryRegionSection section;
+    AddressSpace *target_as = NULL;
+    hwaddr xlat;
+
+    section = flatview_do_translate(fv, addr, &xlat, NULL, NULL, is_write,
+                                    true, &target_as, attrs);
+    if (target_as || memory_access_is_direct(section.mr, is_write)) {
+        /* Accesses through an IOMMU or to RAM are not worth caching.  */
+        return NULL;
+    }
+
+    entry = &cache->entries[cache->next];
+    cache->next = (cache->next + 1) % MMIO_DISPATCH_CACHE_SIZE;
+    *entry = (MMIODispatchCacheEntry) {
+        .as = as,
+        .generation = generation,
+        .start = section.offset_within_address_space,
+        .size = int128_gethi(section.size) ? UINT64_MAX
+                                            : int128_getlo(section.size),
+        .mr = section.mr,
+        .offset_within_region = section.offset_within_region,
+    };
+    return entry;
+}
+
+MemTxResult address_space_mmio_rw(AddressSpace *as, MMIODispatchCache *cache,
+                                  hwaddr addr, MemTxAttrs attrs,
+                                  void *buf, hwaddr len, bool is_write)
+{
+    MMIODispatchCacheEntry *entry = NULL;
+    MemoryRegion *mr;
+    MemTxResult result;
+    unsigned generation;
+    hwaddr mr_addr;
+    bool release_lock;
+    uint64_t val;
+    int i;
+
+    if (!cache || !len || len > 8) {
+        return address_space_rw(as, addr, attrs, buf, len, is_write);
+    }
+
+    RCU_READ_LOCK_GUARD();
+    generation = qatomic_load_acquire(&flatview_generation);
+    for (i = 0; i < MMIO_DISPATCH_CACHE_SIZE; i++) {
+        MMIODispatchCacheEntry *e = &cache->entries[i];
+
+        if (e->as == as && e->generation == generation &&
+            addr - e->start < e->size && len <= e->size - (addr - e->start)) {
+            entry = e;
+            break;
+        }
+    }
+    if (!entry) {
+        entry = mmio_dispatch_cache_fill(as, cache, generation, addr,
+                                         is_write, attrs);
+    }
+
+    /*
+     * Leave anything that needs to be split, or that is not plain MMIO
+     * in the first place, to the generic path.
+     */
+    if (!entry || memory_access_is_direct(entry->mr, is_write) ||
+        len > entry->size - (addr - entry->start)) {
+        return address_space_rw(as, addr, attrs, buf, len, is_write);
+    }
+    mr = entry->mr;
+    mr_addr = addr - entry->start + entry->offset_within_region;
+    if (memory_access_size(mr, len, mr_addr) != len) {
+        return address_space_rw(as, addr, attrs, buf, len, is_write);
+    }
+    if (!flatview_access_allowed(mr, attrs, mr_addr, len)) {
+        return MEMTX_ACCESS_ERROR;
+    }
+
+    release_lock = prepare_mmio_access(mr);
+    if (is_write) {
+        val = ldn_he_p(buf, len);
+        result = memory_region_dispatch_write(mr, mr_addr, val,
+                                              size_memop(len), attrs);
+    } else {
+        result = memory_region_dispatch_read(mr, mr_addr, &val,
+                                             size_memop(len), attrs);
+        stn_he_p(buf, len, val);
+    }
+    if (release_lock) {
+        qemu_mutex_unlock_iothread();
+    }
+
+    return result;
+}
+
 MemTxResult address_space_set(AddressSpace *as, hwaddr addr,
                               uint8_t c, hwaddr len, MemTxAttrs attrs)
 {
@@ -61,6 +61,8 @@ static GTimer *timer;
 static bool qtest_opened;
 static void (*qtest_server_send)(void*, const char*);
 static void *qtest_server_send_opaque;
+/* MMIO dispatch cache of the readX and writeX commands */
+static MMIODispatchCache qtest_mmio_cache;
 
 #define FMT_timeval "%.06f"
 
@@ -204,6 +206,9 @@ static void *qtest_server_send_opaque;
  * ADDR, SIZE, VALUE are all integers parsed with strtoul() with a base of 0.
  * For 'memset' a zero size is permitted and does nothing.
  *
+ * The 'readX' and 'writeX' commands go through address_space_mmio_rw(),
+ * like MMIO exits from KVM, so they also exercise its dispatch cache.
+ *
  * DATA is an arbitrarily long hex number prefixed with '0x'.  If it's smaller
  * than the expected size, the value will be zero filled at the end of the data
  * sequence.
@@ -519,23 +524,23 @@ static void qtest_process_command(CharBackend *chr, gchar **words)
 
         if (words[0][5] == 'b') {
             uint8_t data = value;
-            address_space_write(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                                &data, 1);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 1, true);
         } else if (words[0][5] == 'w') {
             uint16_t data = value;
             tswap16s(&data);
-            address_space_write(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                                &data, 2);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 2, true);
         } else if (words[0][5] == 'l') {
             uint32_t data = value;
             tswap32s(&data);
-            address_space_write(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                                &data, 4);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 4, true);
         } else if (words[0][5] == 'q') {
             uint64_t data = value;
             tswap64s(&data);
-            address_space_write(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                                &data, 8);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 8, true);
         }
         qtest_send_prefix(chr);
         qtest_send(chr, "OK\n");
@@ -553,22 +558,22 @@ static void qtest_process_command(CharBackend *chr, gchar **words)
 
         if (words[0][4] == 'b') {
             uint8_t data;
-            address_space_read(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                               &data, 1);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 1, false);
             value = data;
         } else if (words[0][4] == 'w') {
             uint16_t data;
-            address_space_read(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                               &data, 2);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 2, false);
             value = tswap16(data);
         } else if (words[0][4] == 'l') {
             uint32_t data;
-            address_space_read(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                               &data, 4);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &data, 4, false);
             value = tswap32(data);
         } else if (words[0][4] == 'q') {
-            address_space_read(first_cpu->as, addr, MEMTXATTRS_UNSPECIFIED,
-                               &value, 8);
+            address_space_mmio_rw(first_cpu->as, &qtest_mmio_cache, addr,
+                                  MEMTXATTRS_UNSPECIFIED, &value, 8, false);
             tswap64s(&value);
         }
         qtest_send_prefix(chr);
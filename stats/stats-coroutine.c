@@ -0,0 +1,59 @@
+/*
+ * Coroutine pool statistics
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or
+ * (at your option) any later version.
+ */
+
+#include "qemu/osdep.h"
+#include "qemu/module.h"
+#include "qemu/coroutine.h"
+#include "sysemu/stats.h"
+
+#define POOL_HITS_STR       "pool-hits"
+#define POOL_MISSES_STR     "pool-misses"
+
+static void coroutine_stats_cb(StatsResultList **result, StatsTarget target,
+                               strList *names, strList *targets, Error **errp)
+{
+    StatsList *stats_list = NULL;
+    uint64_t hits, misses;
+
+    if (target != STATS_TARGET_VM) {
+        return;
+    }
+
+    qemu_coroutine_get_pool_stats(&hits, &misses);
+    if (apply_str_list_filter(POOL_MISSES_STR, names)) {
+        stats_list = stats_add_scalar(POOL_MISSES_STR, misses, stats_list);
+    }
+    if (apply_str_list_filter(POOL_HITS_STR, names)) {
+        stats_list = stats_add_scalar(POOL_HITS_STR, hits, stats_list);
+    }
+
+    if (stats_list) {
+        add_stats_entry(result, STATS_PROVIDER_COROUTINE, NULL, stats_list);
+    }
+}
+
+static void coroutine_schemas_cb(StatsSchemaList **result, Error **errp)
+{
+    StatsSchemaValueList *stats_list = NULL;
+
+    /* coroutines taken from a pool, and coroutines that needed a new stack */
+    stats_list = stats_schema_add(POOL_MISSES_STR, STATS_TYPE_CUMULATIVE,
+                                  stats_list);
+    stats_list = stats_schema_add(POOL_HITS_STR, STATS_TYPE_CUMULATIVE,
+                                  stats_list);
+
+    add_stats_schema(result, STATS_PROVIDER_COROUTINE, STATS_TARGET_VM,
+                     stats_list);
+}
+
+static void coroutine_stats_init(void)
+{
+    add_stats_callbacks(STATS_PROVIDER_COROUTINE, coroutine_stats_cb,
+                        coroutine_schemas_cb);
+}
+
+type_init(coroutine_stats_init);
@@ -0,0 +1,111 @@
+/*
+ * Event loop statistics for iothreads
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or
+ * (at your option) any later version.
+ */
+
+#include "qemu/osdep.h"
+#include "qemu/module.h"
+#include "qom/object.h"
+#include "block/aio.h"
+#include "sysemu/iothread.h"
+#include "sysemu/stats.h"
+
+#define POLL_HITS_STR       "poll-hits"
+#define FD_EVENTS_STR       "fd-events"
+#define EVENT_LATENCY_STR   "event-latency"
+
+typedef struct IOThreadStatsArgs {
+    StatsResultList **result;
+    strList *names;
+} IOThreadStatsArgs;
+
+static int iothread_stats_query(Object *obj, void *opaque)
+{
+    IOThreadStatsArgs *args = opaque;
+    IOThread *iothread;
+    AioPollStats *poll_stats;
+    StatsList *stats_list = NULL;
+    g_autofree char *qom_path = NULL;
+    uint64_t latency[AIO_POLL_LATENCY_BUCKETS];
+
+    iothread = (IOThread *)object_dynamic_cast(obj, TYPE_IOTHREAD);
+    if (!iothread || !iothread->ctx) {
+        return 0;
+    }
+
+    poll_stats = &iothread->ctx->poll_stats;
+    if (apply_str_list_filter(EVENT_LATENCY_STR, args->names)) {
+        for (int i = 0; i < AIO_POLL_LATENCY_BUCKETS; i++) {
+            latency[i] = stat64_get(&poll_stats->latency[i]);
+        }
+        stats_list = stats_add_histogram(EVENT_LATENCY_STR, latency,
+                                         AIO_POLL_LATENCY_BUCKETS, stats_list);
+    }
+    if (apply_str_list_filter(FD_EVENTS_STR, args->names)) {
+        stats_list = stats_add_scalar(FD_EVENTS_STR,
+                                      stat64_get(&poll_stats->fd_events),
+                                      stats_list);
+    }
+    if (apply_str_list_filter(POLL_HITS_STR, args->names)) {
+        stats_list = stats_add_scalar(POLL_HITS_STR,
+                                      stat64_get(&poll_stats->poll_hits),
+                                      stats_list);
+    }
+
+    if (stats_list) {
+        qom_path = object_get_canonical_path(obj);
+        add_stats_entry(args->result, STATS_PROVIDER_IOTHREAD, qom_path,
+                        stats_list);
+    }
+    return 0;
+}
+
+static void iothread_stats_cb(StatsResultList **result, StatsTarget target,
+                              strList *names, strList *targets, Error **errp)
+{
+    IOThreadStatsArgs args = {
+        .result = result,
+        .names = names,
+    };
+
+    switch (target) {
+    case STATS_TARGET_IOTHREAD:
+        object_child_foreach(object_get_objects_root(), iothread_stats_query,
+                             &args);
+        break;
+    default:
+        break;
+    }
+}
+
+static void iothread_schemas_cb(StatsSchemaList **result, Error **errp)
+{
+    StatsSchemaValueList *stats_list = NULL;
+
+    stats_list = stats_schema_add(POLL_HITS_STR, STATS_TYPE_CUMULATIVE,
+                                  stats_list);
+    stats_list = stats_schema_add(FD_EVENTS_STR, STATS_TYPE_CUMULATIVE,
+                                  stats_list);
+
+    /* latency of handler events since the start of aio_poll(), in ns */
+    stats_list = stats_schema_add(EVENT_LATENCY_STR, STATS_TYPE_LOG2_HISTOGRAM,
+                                  stats_list);
+    stats_list->value->has_unit = true;
+    stats_list->value->unit = STATS_UNIT_SECONDS;
+    stats_list->value->has_base = true;
+    stats_list->value->base = 10;
+    stats_list->value->exponent = -9;
+
+    add_stats_schema(result, STATS_PROVIDER_IOTHREAD, STATS_TARGET_IOTHREAD,
+                     stats_list);
+}
+
+static void iothread_stats_init(void)
+{
+    add_stats_callbacks(STATS_PROVIDER_IOTHREAD, iothread_stats_cb,
+                        iothread_schemas_cb);
+}
+
+type_init(iothread_stats_init);
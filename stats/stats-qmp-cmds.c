@@ -65,6 +65,7 @@ static bool invoke_stats_cb(StatsCallbacks *entry,
         }
         break;
     case STATS_TARGET_CRYPTODEV:
+    case STATS_TARGET_IOTHREAD:
         break;
     default:
         abort();
@@ -148,6 +149,51 @@ void add_stats_schema(StatsSchemaList **schema_results,
     QAPI_LIST_PREPEND(*schema_results, entry);
 }
 
+StatsList *stats_add_scalar(const char *name, uint64_t val,
+                            StatsList *stats_list)
+{
+    Stats *stats = g_new0(Stats, 1);
+
+    stats->name = g_strdup(name);
+    stats->value = g_new0(StatsValue, 1);
+    stats->value->type = QTYPE_QNUM;
+    stats->value->u.scalar = val;
+
+    QAPI_LIST_PREPEND(stats_list, stats);
+    return stats_list;
+}
+
+StatsList *stats_add_histogram(const char *name, const uint64_t *val, int n,
+                               StatsList *stats_list)
+{
+    Stats *stats = g_new0(Stats, 1);
+    uint64List **tail;
+
+    stats->name = g_strdup(name);
+    stats->value = g_new0(StatsValue, 1);
+    stats->value->type = QTYPE_QLIST;
+    tail = &stats->value->u.list;
+    for (int i = 0; i < n; i++) {
+        QAPI_LIST_APPEND(tail, val[i]);
+    }
+
+    QAPI_LIST_PREPEND(stats_list, stats);
+    return stats_list;
+}
+
+StatsSchemaValueList *stats_schema_add(const char *name, StatsType type,
+                                       StatsSchemaValueList *list)
+{
+    StatsSchemaValueList *schema_entry = g_new0(StatsSchemaValueList, 1);
+
+    schema_entry->value = g_new0(StatsSchemaValue, 1);
+    schema_entry->value->type = type;
+    schema_entry->value->name = g_strdup(name);
+    schema_entry->next = list;
+
+    return schema_entry;
+}
+
 bool apply_str_list_filter(const char *string, strList *list)
 {
     strList *str_list = NULL;
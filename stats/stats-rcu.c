@@ -0,0 +1,94 @@
+/*
+ * RCU statistics
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or
+ * (at your option) any later version.
+ */
+
+#include "qemu/osdep.h"
+#include "qemu/module.h"
+#include "qemu/rcu.h"
+#include "sysemu/stats.h"
+
+#define GRACE_PERIODS_STR           "grace-periods"
+#define EXPEDITED_GRACE_PERIODS_STR "expedited-grace-periods"
+#define CALLBACKS_STR               "callbacks"
+#define BACKLOG_STR                 "backlog"
+#define MAX_BATCH_STR               "max-batch"
+#define GP_LATENCY_STR              "grace-period-latency"
+
+static void rcu_stats_cb(StatsResultList **result, StatsTarget target,
+                         strList *names, strList *targets, Error **errp)
+{
+    StatsList *stats_list = NULL;
+    RCUStats rcu_stats;
+
+    if (target != STATS_TARGET_VM) {
+        return;
+    }
+
+    rcu_get_stats(&rcu_stats);
+    if (apply_str_list_filter(GP_LATENCY_STR, names)) {
+        stats_list = stats_add_histogram(GP_LATENCY_STR, rcu_stats.gp_latency,
+                                         RCU_GP_LATENCY_BUCKETS, stats_list);
+    }
+    if (apply_str_list_filter(MAX_BATCH_STR, names)) {
+        stats_list = stats_add_scalar(MAX_BATCH_STR, rcu_stats.max_batch,
+                                      stats_list);
+    }
+    if (apply_str_list_filter(BACKLOG_STR, names)) {
+        stats_list = stats_add_scalar(BACKLOG_STR, rcu_stats.backlog,
+                                      stats_list);
+    }
+    if (apply_str_list_filter(CALLBACKS_STR, names)) {
+        stats_list = stats_add_scalar(CALLBACKS_STR, rcu_stats.callbacks,
+                                      stats_list);
+    }
+    if (apply_str_list_filter(EXPEDITED_GRACE_PERIODS_STR, names)) {
+        stats_list = stats_add_scalar(EXPEDITED_GRACE_PERIODS_STR,
+                                      rcu_stats.expedited_grace_periods,
+                                      stats_list);
+    }
+    if (apply_str_list_filter(GRACE_PERIODS_STR, names)) {
+        stats_list = stats_add_scalar(GRACE_PERIODS_STR,
+                                      rcu_stats.grace_periods, stats_list);
+    }
+
+    if (stats_list) {
+        add_stats_entry(result, STATS_PROVIDER_RCU, NULL, stats_list);
+    }
+}
+
+static void rcu_schemas_cb(StatsSchemaList **result, Error **errp)
+{
+    StatsSchemaValueList *stats_list = NULL;
+
+    stats_list = stats_schema_add(GRACE_PERIODS_STR, STATS_TYPE_CUMULATIVE,
+                                  stats_list);
+    stats_list = stats_schema_add(EXPEDITED_GRACE_PERIODS_STR,
+                                  STATS_TYPE_CUMULATIVE, stats_list);
+    stats_list = stats_schema_add(CALLBACKS_STR, STATS_TYPE_CUMULATIVE,
+                                  stats_list);
+    stats_list = stats_schema_add(BACKLOG_STR, STATS_TYPE_INSTANT,
+                                  stats_list);
+    stats_list = stats_schema_add(MAX_BATCH_STR, STATS_TYPE_PEAK,
+                                  stats_list);
+
+    /* latency of synchronize_rcu(), in ns */
+    stats_list = stats_schema_add(GP_LATENCY_STR, STATS_TYPE_LOG2_HISTOGRAM,
+                                  stats_list);
+    stats_list->value->has_unit = true;
+    stats_list->value->unit = STATS_UNIT_SECONDS;
+    stats_list->value->has_base = true;
+    stats_list->value->base = 10;
+    stats_list->value->exponent = -9;
+
+    add_stats_schema(result, STATS_PROVIDER_RCU, STATS_TARGET_VM, stats_list);
+}
+
+static void rcu_stats_init(void)
+{
+    add_stats_callbacks(STATS_PROVIDER_RCU, rcu_stats_cb, rcu_schemas_cb);
+}
+
+type_init(rcu_stats_init);
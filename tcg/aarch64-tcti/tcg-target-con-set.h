@@ -13,6 +13,7 @@
 // Simple register functions.
 C_O0_I1(r)
 C_O0_I2(r, r)
+C_O0_I2(r, rZ)
 C_O0_I3(r, r, r)
 //C_O0_I4(r, r, r, r)
 C_O1_I1(r, r)
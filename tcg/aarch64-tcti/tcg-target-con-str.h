@@ -18,3 +18,6 @@ REGS('w', TCG_MASK_VECTOR_REGISTERS)
 
 // Simple 64-bit immediates.
 CONST('I', 0xFFFFFFFFFFFFFFFF)
+
+// Constants that must be zero.
+CONST('Z', TCG_CT_CONST_ZERO)
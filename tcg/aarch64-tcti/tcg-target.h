@@ -56,6 +56,15 @@
 // weird psuedo-native bytecode. We'll indicate that we're intepreted.
 #define TCG_TARGET_INTERPRETER 1
 
+// Count how often each op (and each short sequence of ops) executes, for tcti-gadget-gen.py.
+// This slows down execution considerably; see README.md.
+//#define TCTI_GADGET_PROFILING
+
+// Profiling keeps a record per TB, which has to go when the TBs are flushed.
+#if defined(TCTI_GADGET_PROFILING)
+#define TCG_TARGET_NEED_REGION_RESET
+#endif
+
 //
 // Supported optional scalar instructions.
 //
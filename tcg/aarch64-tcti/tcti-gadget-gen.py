@@ -6,6 +6,7 @@
 
 import os
 import sys
+import argparse
 import itertools
 
 # Epilogue code follows at the end of each gadget, and handles continuing execution.
@@ -32,10 +33,59 @@
 # offsets into its structure. These should match the offsets in tcg-target.c.in.
 QEMU_ALLOWED_MMU_OFFSETS = [ 32, 48, 64, 96, 128 ]
 
+# Op sequences that we have fused gadgets for; see the "fused" collection, below.
+FUSED_SEQUENCES = {
+    ("ld_i32", "brcond_i32"):   "ld32_env_neg_brcondz_lt",
+    ("movi_i32", "st_i32"):     "movi_st_i32_env",
+    ("movi_i64", "st_i64"):     "movi_st_i64_env_sh8",
+}
+
+# The number of hot op sequences to report when given a profile.
+PROFILE_REPORT_LENGTH = 25
+
 # Statistics.
 gadgets      = 0
 instructions = 0
 
+
+def report_profile(path):
+    """ Reports the hottest op sequences in a profile written by a TCTI_GADGET_PROFILING build.
+
+    Each line of the profile holds an execution count, followed by the sequence of ops it applies to.
+    Single ops give a baseline for how often gadgets run; sequences that run about as often as their
+    ops, and that don't already have a fused gadget, are the best candidates for new superinstructions.
+    """
+
+    op_counts = {}
+    sequences = []
+
+    with open(path) as profile:
+        for line in profile:
+            fields = line.split()
+            if not fields or fields[0].startswith("#"):
+                continue
+
+            count, ops = int(fields[0]), tuple(fields[1:])
+            if len(ops) == 1:
+                op_counts[ops[0]] = count
+            else:
+                sequences.append((count, ops))
+
+    total = sum(op_counts.values()) or 1
+
+    sys.stderr.write(f"\nHottest op sequences in {path}:\n")
+    for count, ops in sorted(sequences, reverse=True)[:PROFILE_REPORT_LENGTH]:
+        fused = FUSED_SEQUENCES.get(ops[:2]) if len(ops) == 2 else None
+        note  = f"(fused: {fused})" if fused else ""
+        sys.stderr.write(f"  {count * 100 / total:6.2f}%  {' '.join(ops):<48} {note}\n")
+    sys.stderr.write("\n")
+
+
+parser = argparse.ArgumentParser(description="Generates gadgets for the TCTI backend.")
+parser.add_argument("--profile", metavar="FILE",
+    help="report on an op profile written by a TCTI_GADGET_PROFILING build")
+args = parser.parse_args()
+
 # Files to write to.
 current_collection = "basic"
 output_files = {}
@@ -696,6 +746,14 @@ def vector_logic_dnm(name, operation):
     "ret"
 )
 
+# Count an execution of a TB, for gadget profiling. Takes the address of the counter as an immediate.
+simple("profile_tb",
+    "ldr x27, [x28], #8",
+    "ldr x26, [x27]",
+    "add x26, x26, #1",
+    "str x26, [x27]"
+)
+
 # Memory barriers.
 simple("mb_all", "dmb ish")
 simple("mb_st",  "dmb ishst")
@@ -758,6 +816,20 @@ def vector_logic_dnm(name, operation):
         f"csel x28, x27, x28, {condition}"
     )
 
+    # Comparisons against zero are common enough (e.g. the exit checks at TB
+    # entry) to warrant their own variants, which save a register load of the
+    # constant. As above, the d argument is only used to spread out branch sources.
+    with_dn(f'brcondz_i32_{condition}',
+        "ldr x27, [x28], #8",
+        "subs wzr, Wn, #0",
+        f"csel x28, x27, x28, {condition}"
+    )
+    with_dn(f'brcondz_i64_{condition}',
+        "ldr x27, [x28], #8",
+        "subs xzr, Xn, #0",
+        f"csel x28, x27, x28, {condition}"
+    )
+
 
 START_COLLECTION("mov")
 
@@ -924,6 +996,31 @@ def vector_logic_dnm(name, operation):
 with_dn("bswap64",    "rev Xd, Xn")
 
 
+START_COLLECTION("fused")
+
+#
+# Superinstructions: gadgets that fuse sequences of operations that are hot in
+# nearly every TB into a single dispatch. The backend substitutes these for
+# the individual gadgets at emission time; see tcti_fuse_* in tcg-target.c.inc.
+#
+
+# TB-entry exit check: load icount_decr.u32 (at a small negative offset from env)
+# and branch if it's negative.
+with_d_immediate("ld32_env_neg_brcondz_lt",
+    "ldr Wd, [x14, #-Ii]",
+    "ldr x27, [x28], #8",
+    "subs wzr, Wd, #0",
+    "csel x28, x27, x28, lt",
+    immediate_range=range(64)
+)
+
+# Constant stores into env (e.g. guest PC updates): move an immediate into a
+# register and store it. The register is still written, as later ops may use it.
+with_d_immediate("movi_st_i32_env",     "ldr Wd, [x28], #8", "str Wd, [x14, #Ii]",        immediate_range=range(64))
+with_d_immediate("movi_st_i32_env_sh8", "ldr Wd, [x28], #8", "str Wd, [x14, #(Ii << 3)]", immediate_range=range(64))
+with_d_immediate("movi_st_i64_env_sh8", "ldr Xd, [x28], #8", "str Xd, [x14, #(Ii << 3)]", immediate_range=range(64))
+
+
 # Handlers for QEMU_LD, which handles guest <- host loads.
 for subtype in ('aligned', 'unaligned', 'slowpath'):
     is_aligned  = (subtype == 'aligned')
@@ -1159,5 +1256,9 @@ def vector_logic_dnm(name, operation):
 
 print(f"]", file=sys.stderr)
 
+# Profile report, if requested.
+if args.profile:
+    report_profile(args.profile)
+
 # Statistics.
 sys.stderr.write(f"\nGenerated {gadgets} gadgets with {instructions} instructions (~{(instructions * 4) // 1024 // 1024} MiB).\n\n")
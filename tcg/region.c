@@ -397,6 +397,9 @@ void tcg_region_reset_all(void)
     qemu_mutex_unlock(&region.lock);
 
     tcg_region_tree_reset_all();
+#ifdef TCG_TARGET_NEED_REGION_RESET
+    tcg_target_region_reset();
+#endif
 }
 
 static size_t tcg_n_regions(size_t tb_size, unsigned max_cpus)
@@ -87,6 +87,10 @@ void tcg_region_init(size_t tb_size, int splitwx, unsigned max_cpus);
 bool tcg_region_alloc(TCGContext *s);
 void tcg_region_initial_alloc(TCGContext *s);
 void tcg_region_prologue_set(TCGContext *s);
+#ifdef TCG_TARGET_NEED_REGION_RESET
+/* Called by tcg_region_reset_all(), once all TBs are gone. */
+void tcg_target_region_reset(void);
+#endif
 
 static inline void *tcg_call_func(TCGOp *op)
 {
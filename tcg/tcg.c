@@ -4688,6 +4688,42 @@ static void load_arg_ref(TCGContext *s, int arg_slot, TCGReg ref_base,
     }
 }
 
+/*
+ * Move @ts, which is live across a helper call with @flags, from its
+ * call-clobbered register to a free call-saved register.  Return false
+ * if there is no such register, in which case the caller spills as usual.
+ */
+static bool temp_move_call_saved(TCGContext *s, TCGTemp *ts, int flags,
+                                 TCGRegSet allocated_regs)
+{
+    TCGRegSet set;
+    int i;
+
+    if (ts->kind == TEMP_CONST) {
+        /* Constants are cheaper to rematerialize. */
+        return false;
+    }
+    if (ts->kind == TEMP_GLOBAL && !(flags & TCG_CALL_NO_WRITE_GLOBALS)) {
+        /* save_globals() will spill it anyway. */
+        return false;
+    }
+
+    set = tcg_target_available_regs[ts->type]
+        & ~tcg_target_call_clobber_regs & ~allocated_regs;
+    for (i = 0; i < ARRAY_SIZE(tcg_target_reg_alloc_order); i++) {
+        TCGReg reg = tcg_target_reg_alloc_order[i];
+
+        if (tcg_regset_test_reg(set, reg) && s->reg_to_temp[reg] == NULL) {
+            if (!tcg_out_mov(s, ts->type, reg, ts->reg)) {
+                return false;
+            }
+            set_temp_val_reg(s, ts, reg);
+            return true;
+        }
+    }
+    return false;
+}
+
 static void tcg_reg_alloc_call(TCGContext *s, TCGOp *op)
 {
     const int nb_oargs = TCGOP_CALLO(op);
@@ -4733,10 +4769,18 @@ static void tcg_reg_alloc_call(TCGContext *s, TCGOp *op)
         }
     }
 
-    /* Clobber call registers.  */
+    /*
+     * Clobber call registers.  Any temp still in a register is live
+     * across the call, so prefer moving it to a free call-saved
+     * register over a spill and reload.
+     */
     for (i = 0; i < TCG_TARGET_NB_REGS; i++) {
         if (tcg_regset_test_reg(tcg_target_call_clobber_regs, i)) {
-            tcg_reg_free(s, i, allocated_regs);
+            TCGTemp *ts = s->reg_to_temp[i];
+            if (ts == NULL ||
+                !temp_move_call_saved(s, ts, info->flags, allocated_regs)) {
+                tcg_reg_free(s, i, allocated_regs);
+            }
         }
     }
 
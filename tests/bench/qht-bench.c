@@ -11,6 +11,7 @@
 #include "qemu/rcu.h"
 #include "qemu/xxhash.h"
 #include "qemu/memalign.h"
+#include "qemu/bitmap.h"
 
 struct thread_stats {
     size_t rd;
@@ -69,6 +70,9 @@ static uint64_t resize_threshold;
 static size_t qht_n_elems = DEFAULT_QHT_N_ELEMS;
 static int qht_mode;
 
+static unsigned long *pin_cpus;
+static unsigned int n_pin_cpus;
+
 static bool test_start;
 static bool test_stop;
 
@@ -80,6 +84,7 @@ static const char commands_string[] =
     "\n"
     " -o = offset at which keys start\n"
     " -p = precompute hashes\n"
+    " -A = pin threads round-robin to a list of host CPUs, e.g. 0-7,64-71\n"
     "\n"
     " -g = set -s,-k,-K,-l,-r to the same value\n"
     " -s = initial size hint\n"
@@ -91,6 +96,7 @@ static const char commands_string[] =
     " -u = update rate (0.0 to 100.0), 50/50 split of insertions/removals\n"
     "\n"
     " -R = enable auto-resize\n"
+    " -P = partition the hash table\n"
     " -S = resize rate (0.0 to 100.0)\n"
     " -D = delay (in us) between potential resizes\n"
     " -N = number of resize threads";
@@ -239,6 +245,22 @@ static void prepare_thread_info(struct thread_info *info, int i)
     memset(&info->stats, 0, sizeof(info->stats));
 }
 
+static void pin_thread(QemuThread *th, int i)
+{
+    unsigned long cpu = pin_cpus[i % n_pin_cpus];
+    unsigned long *bmap = bitmap_new(cpu + 1);
+    int err;
+
+    set_bit(cpu, bmap);
+    err = qemu_thread_set_affinity(th, bmap, cpu + 1);
+    if (err) {
+        fprintf(stderr, "cannot pin thread to CPU %lu: %s\n",
+                cpu, strerror(err < 0 ? -err : err));
+        exit(1);
+    }
+    g_free(bmap);
+}
+
 static void
 th_create_n(QemuThread **threads, struct thread_info **infos, const char *name,
             void (*func)(struct thread_info *), int offset, int n)
@@ -258,6 +280,9 @@ th_create_n(QemuThread **threads, struct thread_info **infos, const char *name,
         info[i].func = func;
         qemu_thread_create(&th[i], name, thread_func, &info[i],
                            QEMU_THREAD_JOINABLE);
+        if (n_pin_cpus) {
+            pin_thread(&th[i], offset + i);
+        }
     }
 }
 
@@ -276,6 +301,17 @@ static void pr_params(void)
     printf(" initial size hint: %zu\n", qht_n_elems);
     printf(" auto-resize:       %s\n",
            qht_mode & QHT_MODE_AUTO_RESIZE ? "on" : "off");
+    printf(" partitioned:       %s\n",
+           qht_mode & QHT_MODE_PARTITIONED ? "on" : "off");
+    if (n_pin_cpus) {
+        unsigned int i;
+
+        printf(" pinned to CPUs:   ");
+        for (i = 0; i < n_pin_cpus; i++) {
+            printf(" %lu", pin_cpus[i]);
+        }
+        printf("\n");
+    }
     if (resize_rate) {
         printf(" resize_rate:       %f%%\n", resize_rate * 100.0);
         printf(" resize range:      %zu-%zu\n", resize_min, resize_max);
@@ -440,16 +476,47 @@ static void run_test(void)
     }
 }
 
+static void parse_cpu_list(const char *str)
+{
+    g_auto(GStrv) ranges = g_strsplit(str, ",", -1);
+    GArray *cpus = g_array_new(false, false, sizeof(unsigned long));
+    int i;
+
+    for (i = 0; ranges[i]; i++) {
+        g_auto(GStrv) bounds = g_strsplit(ranges[i], "-", 2);
+        unsigned long first, last, cpu;
+
+        first = strtoul(bounds[0], NULL, 0);
+        last = bounds[1] ? strtoul(bounds[1], NULL, 0) : first;
+        if (last < first) {
+            fprintf(stderr, "invalid CPU range: %s\n", ranges[i]);
+            exit(1);
+        }
+        for (cpu = first; cpu <= last; cpu++) {
+            g_array_append_val(cpus, cpu);
+        }
+    }
+    if (!cpus->len) {
+        fprintf(stderr, "empty CPU list: %s\n", str);
+        exit(1);
+    }
+    n_pin_cpus = cpus->len;
+    pin_cpus = (unsigned long *)g_array_free(cpus, false);
+}
+
 static void parse_args(int argc, char *argv[])
 {
     int c;
 
     for (;;) {
-        c = getopt(argc, argv, "d:D:g:k:K:l:hn:N:o:pr:Rs:S:u:");
+        c = getopt(argc, argv, "A:d:D:g:k:K:l:hn:N:o:pPr:Rs:S:u:");
         if (c < 0) {
             break;
         }
         switch (c) {
+        case 'A':
+            parse_cpu_list(optarg);
+            break;
         case 'd':
             duration = atoi(optarg);
             break;
@@ -488,6 +555,9 @@ static void parse_args(int argc, char *argv[])
             precompute_hash = true;
             hfunc = hval;
             break;
+        case 'P':
+            qht_mode |= QHT_MODE_PARTITIONED;
+            break;
         case 'r':
             update_range = pow2ceil(atol(optarg));
             break;
@@ -0,0 +1,141 @@
+/*
+ * Check that per-vCPU inline operations and conditional callbacks agree
+ * with plain callbacks.
+ *
+ * License: GNU GPL, version 2 or later.
+ *   See the COPYING file in the top-level directory.
+ */
+#include <inttypes.h>
+#include <stdio.h>
+#include <glib.h>
+
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+/* call the conditional callback every COND_PERIOD tbs */
+#define COND_PERIOD 16
+
+typedef struct {
+    uint64_t tb_cb;
+    uint64_t tb_inline;
+    uint64_t tb_cond_counter;
+    uint64_t tb_cond_cb;
+    uint64_t insn_cb;
+    uint64_t insn_inline;
+    uint64_t mem_cb;
+    uint64_t mem_inline;
+} CPUCount;
+
+static struct qemu_plugin_scoreboard *counts;
+static qemu_plugin_u64 tb_cb;
+static qemu_plugin_u64 tb_inline;
+static qemu_plugin_u64 tb_cond_counter;
+static qemu_plugin_u64 tb_cond_cb;
+static qemu_plugin_u64 insn_cb;
+static qemu_plugin_u64 insn_inline;
+static qemu_plugin_u64 mem_cb;
+static qemu_plugin_u64 mem_inline;
+
+static void check(const char *what, uint64_t expected, uint64_t got)
+{
+    g_autofree gchar *out = g_strdup_printf("%s: %" PRIu64 " (expected %"
+                                            PRIu64 ")\n", what, got, expected);
+    qemu_plugin_outs(out);
+    g_assert(expected == got);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+    uint64_t tbs = qemu_plugin_u64_sum(tb_cb);
+
+    check("tb inline", tbs, qemu_plugin_u64_sum(tb_inline));
+    /* each conditional call consumed exactly COND_PERIOD tb executions */
+    check("tb cond", tbs,
+          qemu_plugin_u64_sum(tb_cond_cb) * COND_PERIOD +
+          qemu_plugin_u64_sum(tb_cond_counter));
+    check("insn inline", qemu_plugin_u64_sum(insn_cb),
+          qemu_plugin_u64_sum(insn_inline));
+    check("mem inline", qemu_plugin_u64_sum(mem_cb),
+          qemu_plugin_u64_sum(mem_inline));
+
+    qemu_plugin_scoreboard_free(counts);
+}
+
+static void vcpu_tb_exec(unsigned int cpu_index, void *udata)
+{
+    qemu_plugin_u64_add(tb_cb, cpu_index, 1);
+}
+
+static void vcpu_tb_cond_exec(unsigned int cpu_index, void *udata)
+{
+    g_assert(qemu_plugin_u64_get(tb_cond_counter, cpu_index) == COND_PERIOD);
+    qemu_plugin_u64_set(tb_cond_counter, cpu_index, 0);
+    qemu_plugin_u64_add(tb_cond_cb, cpu_index, 1);
+}
+
+static void vcpu_insn_exec(unsigned int cpu_index, void *udata)
+{
+    qemu_plugin_u64_add(insn_cb, cpu_index, 1);
+}
+
+static void vcpu_mem_access(unsigned int cpu_index, qemu_plugin_meminfo_t info,
+                            uint64_t vaddr, void *udata)
+{
+    qemu_plugin_u64_add(mem_cb, cpu_index, 1);
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+    size_t n = qemu_plugin_tb_n_insns(tb);
+
+    qemu_plugin_register_vcpu_tb_exec_cb(tb, vcpu_tb_exec,
+                                         QEMU_PLUGIN_CB_NO_REGS, NULL);
+    qemu_plugin_register_vcpu_tb_exec_inline_per_vcpu(
+        tb, QEMU_PLUGIN_INLINE_ADD_U64, tb_inline, 1);
+    qemu_plugin_register_vcpu_tb_exec_inline_per_vcpu(
+        tb, QEMU_PLUGIN_INLINE_ADD_U64, tb_cond_counter, 1);
+    qemu_plugin_register_vcpu_tb_exec_cond_cb(
+        tb, vcpu_tb_cond_exec, QEMU_PLUGIN_CB_NO_REGS,
+        QEMU_PLUGIN_COND_EQ, tb_cond_counter, COND_PERIOD, NULL);
+
+    for (size_t i = 0; i < n; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+
+        qemu_plugin_register_vcpu_insn_exec_cb(insn, vcpu_insn_exec,
+                                               QEMU_PLUGIN_CB_NO_REGS, NULL);
+        qemu_plugin_register_vcpu_insn_exec_inline_per_vcpu(
+            insn, QEMU_PLUGIN_INLINE_ADD_U64, insn_inline, 1);
+        qemu_plugin_register_vcpu_mem_cb(insn, vcpu_mem_access,
+                                         QEMU_PLUGIN_CB_NO_REGS,
+                                         QEMU_PLUGIN_MEM_RW, NULL);
+        qemu_plugin_register_vcpu_mem_inline_per_vcpu(
+            insn, QEMU_PLUGIN_MEM_RW, QEMU_PLUGIN_INLINE_ADD_U64,
+            mem_inline, 1);
+    }
+}
+
+QEMU_PLUGIN_EXPORT
+int qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info,
+                        int argc, char **argv)
+{
+    counts = qemu_plugin_scoreboard_new(sizeof(CPUCount));
+    tb_cb = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount, tb_cb);
+    tb_inline = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount,
+                                                     tb_inline);
+    tb_cond_counter = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount,
+                                                           tb_cond_counter);
+    tb_cond_cb = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount,
+                                                      tb_cond_cb);
+    insn_cb = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount, insn_cb);
+    insn_inline = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount,
+                                                       insn_inline);
+    mem_cb = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount, mem_cb);
+    mem_inline = qemu_plugin_scoreboard_u64_in_struct(counts, CPUCount,
+                                                      mem_inline);
+
+    qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+
+    return 0;
+}
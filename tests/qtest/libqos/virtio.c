@@ -392,6 +392,29 @@ void qvirtqueue_kick(QTestState *qts, QVirtioDevice *d, QVirtQueue *vq,
     }
 }
 
+/*
+ * Like qvirtqueue_kick(), but make @n chains available at once, so that
+ * the device sees all of them on a single notification.
+ */
+void qvirtqueue_kick_batch(QTestState *qts, QVirtioDevice *d, QVirtQueue *vq,
+                           const uint32_t *free_heads, int n)
+{
+    /* vq->avail->idx */
+    uint16_t idx = qvirtio_readw(d, qts, vq->avail + 2);
+    int i;
+
+    g_assert(n > 0);
+    for (i = 0; i < n - 1; i++) {
+        /* vq->avail->ring[(idx + i) % vq->size] */
+        qvirtio_writew(d, qts, vq->avail + 4 + (2 * ((idx + i) % vq->size)),
+                       free_heads[i]);
+    }
+    /* vq->avail->idx */
+    qvirtio_writew(d, qts, vq->avail + 2, idx + n - 1);
+
+    qvirtqueue_kick(qts, d, vq, free_heads[n - 1]);
+}
+
 /*
  * qvirtqueue_get_buf:
  * @desc_idx: A pointer that is filled with the vq->desc[] index, may be NULL
@@ -0,0 +1,242 @@
+/*
+ * QTest testcase for remapping the BARs of many PCI devices
+ *
+ * Every BAR move and every toggle of memory decoding is a memory
+ * transaction that updates the FlatViews of the machine.  Besides
+ * checking that all devices stay reachable, run with "-m perf" to
+ * measure how long such updates take with a large number of BARs.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "libqtest.h"
+#include "libqos/pci-pc.h"
+#include "hw/pci/pci.h"
+#include "hw/pci/pci_regs.h"
+
+#define NUM_DEVICES 24
+#define FIRST_SLOT 2
+#define PERF_ROUNDS 100
+
+/* offsetof(PCITestDevHdr, name), the test selected by writing 0 is "mmio" */
+#define TESTDEV_NAME_OFFSET 16
+
+typedef struct TestData {
+    QTestState *qts;
+    QPCIBus *bus;
+    QPCIDevice *devs[NUM_DEVICES];
+    QPCIBar bars[NUM_DEVICES];
+    int n;
+} TestData;
+
+static void save_fn(QPCIDevice *dev, int devfn, void *data)
+{
+    TestData *d = data;
+
+    g_assert_cmpint(d->n, <, NUM_DEVICES);
+    d->devs[d->n++] = dev;
+}
+
+static void test_setup(TestData *d)
+{
+    g_autoptr(GString) cmd = g_string_new("-machine pc -nodefaults");
+    int i;
+
+    for (i = 0; i < NUM_DEVICES; i++) {
+        g_string_append_printf(cmd, " -device pci-testdev,addr=%d",
+                               FIRST_SLOT + i);
+    }
+
+    memset(d, 0, sizeof(*d));
+    d->qts = qtest_init(cmd->str);
+    d->bus = qpci_new_pc(d->qts, NULL);
+    qpci_device_foreach(d->bus, PCI_VENDOR_ID_REDHAT,
+                        PCI_DEVICE_ID_REDHAT_TEST, save_fn, d);
+    g_assert_cmpint(d->n, ==, NUM_DEVICES);
+
+    for (i = 0; i < NUM_DEVICES; i++) {
+        d->bars[i] = qpci_iomap(d->devs[i], 0, NULL);
+        qpci_device_enable(d->devs[i]);
+    }
+}
+
+static void test_teardown(TestData *d)
+{
+    int i;
+
+    for (i = 0; i < NUM_DEVICES; i++) {
+        g_free(d->devs[i]);
+    }
+    qpci_free_pc(d->bus);
+    qtest_quit(d->qts);
+}
+
+static void set_mem_decode(QPCIDevice *dev, bool enable)
+{
+    uint16_t cmd = qpci_config_readw(dev, PCI_COMMAND);
+
+    if (enable) {
+        cmd |= PCI_COMMAND_MEMORY;
+    } else {
+        cmd &= ~PCI_COMMAND_MEMORY;
+    }
+    qpci_config_writew(dev, PCI_COMMAND, cmd);
+}
+
+static bool bar_responds(QPCIDevice *dev, QPCIBar bar)
+{
+    qpci_io_writeb(dev, bar, 0, 0);
+    return qpci_io_readb(dev, bar, TESTDEV_NAME_OFFSET) == 'm';
+}
+
+static void check_all_bars(TestData *d)
+{
+    int i;
+
+    for (i = 0; i < NUM_DEVICES; i++) {
+        g_assert(bar_responds(d->devs[i], d->bars[i]));
+    }
+}
+
+static void test_toggle(void)
+{
+    TestData d;
+    int i;
+
+    test_setup(&d);
+    check_all_bars(&d);
+
+    for (i = 0; i < NUM_DEVICES; i++) {
+        set_mem_decode(d.devs[i], false);
+        g_assert(!bar_responds(d.devs[i], d.bars[i]));
+        if (i > 0) {
+            g_assert(bar_responds(d.devs[i - 1], d.bars[i - 1]));
+        }
+        set_mem_decode(d.devs[i], true);
+    }
+    check_all_bars(&d);
+
+    test_teardown(&d);
+}
+
+static void swap_bars(TestData *d, int i, int j)
+{
+    QPCIBar tmp;
+    uint32_t bar0, bar1;
+
+    set_mem_decode(d->devs[i], false);
+    set_mem_decode(d->devs[j], false);
+
+    bar0 = qpci_config_readl(d->devs[i], PCI_BASE_ADDRESS_0);
+    bar1 = qpci_config_readl(d->devs[j], PCI_BASE_ADDRESS_0);
+    qpci_config_writel(d->devs[i], PCI_BASE_ADDRESS_0, bar1);
+    qpci_config_writel(d->devs[j], PCI_BASE_ADDRESS_0, bar0);
+    tmp = d->bars[i];
+    d->bars[i] = d->bars[j];
+    d->bars[j] = tmp;
+
+    set_mem_decode(d->devs[i], true);
+    set_mem_decode(d->devs[j], true);
+}
+
+/* Exchange the BAR addresses of neighbouring devices. */
+static void test_move(void)
+{
+    TestData d;
+    int i;
+
+    test_setup(&d);
+
+    for (i = 0; i + 1 < NUM_DEVICES; i += 2) {
+        swap_bars(&d, i, i + 1);
+    }
+    check_all_bars(&d);
+
+    test_teardown(&d);
+}
+
+/*
+ * The readX and writeX qtest commands go through the MMIO dispatch cache
+ * of address_space_mmio_rw(), like MMIO exits from KVM.  Check that the
+ * cached translations follow a BAR move, and that accesses wider than the
+ * device supports are still split.
+ */
+static void test_mmio_cache(void)
+{
+    TestData d;
+    uint64_t addr0, addr1;
+    uint64_t val;
+    int i;
+
+    test_setup(&d);
+    addr0 = d.bars[0].addr;
+    addr1 = d.bars[1].addr;
+
+    /* Only the first device has a test selected and returns its name */
+    qtest_writeb(d.qts, addr0, 0);
+    qtest_writeb(d.qts, addr1, 0xff);
+
+    /* The first round fills the cache, the second one hits in it */
+    for (i = 0; i < 2; i++) {
+        g_assert_cmpint(qtest_readb(d.qts, addr0 + TESTDEV_NAME_OFFSET),
+                        ==, 'm');
+        g_assert_cmpint(qtest_readb(d.qts, addr1 + TESTDEV_NAME_OFFSET),
+                        ==, 0);
+    }
+
+    /* Moving the BARs changes the memory map, the old entries must miss */
+    swap_bars(&d, 0, 1);
+    g_assert_cmpint(qtest_readb(d.qts, addr0 + TESTDEV_NAME_OFFSET), ==, 0);
+    g_assert_cmpint(qtest_readb(d.qts, addr1 + TESTDEV_NAME_OFFSET), ==, 'm');
+
+    /* pci-testdev takes at most 4 bytes, so this is two accesses */
+    val = qtest_readq(d.qts, addr1);
+    g_assert_cmphex(val, !=, 0);
+    g_assert_cmphex(val, ==, qtest_readl(d.qts, addr1) |
+                             (uint64_t)qtest_readl(d.qts, addr1 + 4) << 32);
+
+    test_teardown(&d);
+}
+
+static void perf_toggle(void)
+{
+    TestData d;
+    double duration;
+    int i, j;
+
+    test_setup(&d);
+
+    g_test_timer_start();
+    for (j = 0; j < PERF_ROUNDS; j++) {
+        for (i = 0; i < NUM_DEVICES; i++) {
+            set_mem_decode(d.devs[i], false);
+        }
+        for (i = 0; i < NUM_DEVICES; i++) {
+            set_mem_decode(d.devs[i], true);
+        }
+    }
+    duration = g_test_timer_elapsed();
+    check_all_bars(&d);
+
+    g_test_message("%d devices, %d BAR updates: %f s, %f updates/s",
+                   NUM_DEVICES, 2 * NUM_DEVICES * PERF_ROUNDS, duration,
+                   2 * NUM_DEVICES * PERF_ROUNDS / duration);
+
+    test_teardown(&d);
+}
+
+int main(int argc, char **argv)
+{
+    g_test_init(&argc, &argv, NULL);
+
+    qtest_add_func("/pci-bar/toggle", test_toggle);
+    qtest_add_func("/pci-bar/move", test_move);
+    qtest_add_func("/pci-bar/mmio-cache", test_mmio_cache);
+    if (g_test_perf()) {
+        qtest_add_func("/pci-bar/perf/toggle", perf_toggle);
+    }
+
+    return g_test_run();
+}
@@ -695,6 +695,276 @@ static void idx(void *obj, void *u_data, QGuestAllocator *t_alloc)
     qvirtqueue_cleanup(dev->bus, vq, t_alloc);
 }
 
+/*
+ * Submit a one sector write and wait for it to be used.  The virtual clock
+ * does not move meanwhile, so any coalescing timer stays pending.
+ */
+static void coalesce_request(QVirtioDevice *dev, QGuestAllocator *alloc,
+                             QVirtQueue *vq)
+{
+    QTestState *qts = global_qtest;
+    QVirtioBlkReq req;
+    uint64_t req_addr;
+    uint32_t free_head;
+    uint32_t desc_idx;
+    gint64 start_time = g_get_monotonic_time();
+
+    req.type = VIRTIO_BLK_T_OUT;
+    req.ioprio = 1;
+    req.sector = 0;
+    req.data = g_malloc0(512);
+
+    req_addr = virtio_blk_request(alloc, dev, &req, 512);
+
+    g_free(req.data);
+
+    free_head = qvirtqueue_add(qts, vq, req_addr, 16, false, true);
+    qvirtqueue_add(qts, vq, req_addr + 16, 512, false, true);
+    qvirtqueue_add(qts, vq, req_addr + 528, 1, true, false);
+    qvirtqueue_kick(qts, dev, vq, free_head);
+
+    while (!qvirtqueue_get_buf(qts, vq, &desc_idx, NULL)) {
+        g_assert(g_get_monotonic_time() - start_time <=
+                 QVIRTIO_BLK_TIMEOUT_US);
+    }
+    g_assert_cmpint(desc_idx, ==, free_head);
+    g_assert_cmpint(readb(req_addr + 528), ==, 0);
+
+    guest_free(alloc, req_addr);
+}
+
+static QVirtQueue *virtio_blk_setup_vq(QVirtioDevice *dev,
+                                       QGuestAllocator *alloc)
+{
+    uint64_t features;
+    QVirtQueue *vq;
+
+    /* Without EVENT_IDX every completion asks for a notification */
+    features = qvirtio_get_features(dev);
+    features = features & ~(QVIRTIO_F_BAD_FEATURE |
+                            (1u << VIRTIO_RING_F_INDIRECT_DESC) |
+                            (1u << VIRTIO_RING_F_EVENT_IDX) |
+                            (1u << VIRTIO_BLK_F_SCSI));
+    qvirtio_set_features(dev, features);
+
+    vq = qvirtqueue_setup(dev, alloc, 0);
+    qvirtio_set_driver_ok(dev);
+    return vq;
+}
+
+/* Runs with coalesce-usecs=1000,coalesce-max-frames=3 */
+static void coalesce(void *obj, void *u_data, QGuestAllocator *t_alloc)
+{
+    QVirtioBlkPCI *blk = obj;
+    QVirtioDevice *dev = &blk->pci_vdev.vdev;
+    QTestState *qts = global_qtest;
+    QVirtQueue *vq;
+
+    vq = virtio_blk_setup_vq(dev, t_alloc);
+
+    /* The first completion after an idle period is signalled at once */
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(dev->bus->get_queue_isr_status(dev, vq));
+
+    /* The next one is held back until 1 ms after the first notification */
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(!dev->bus->get_queue_isr_status(dev, vq));
+    qtest_clock_step(qts, 999 * 1000);
+    g_assert(!dev->bus->get_queue_isr_status(dev, vq));
+    qtest_clock_step(qts, 1000);
+    qvirtio_wait_queue_isr(qts, dev, vq, QVIRTIO_BLK_TIMEOUT_US);
+
+    /* The third pending completion is signalled without waiting */
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(!dev->bus->get_queue_isr_status(dev, vq));
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(!dev->bus->get_queue_isr_status(dev, vq));
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(dev->bus->get_queue_isr_status(dev, vq));
+
+    qvirtqueue_cleanup(dev->bus, vq, t_alloc);
+}
+
+/*
+ * More completions per millisecond than virtio.c's VIRTIO_COALESCE_HIGH_RATE,
+ * which selects the full coalescing interval.
+ */
+#define COALESCE_BUSY_REQUESTS 65
+
+/* Runs with coalesce-usecs=1000,coalesce-adaptive=on */
+static void coalesce_adaptive(void *obj, void *u_data,
+                              QGuestAllocator *t_alloc)
+{
+    QVirtioBlkPCI *blk = obj;
+    QVirtioDevice *dev = &blk->pci_vdev.vdev;
+    QTestState *qts = global_qtest;
+    QVirtQueue *vq;
+    int i;
+
+    vq = virtio_blk_setup_vq(dev, t_alloc);
+
+    /* Until a busy period has been measured, nothing is held back */
+    for (i = 0; i < COALESCE_BUSY_REQUESTS; i++) {
+        coalesce_request(dev, t_alloc, vq);
+        g_assert(dev->bus->get_queue_isr_status(dev, vq));
+    }
+
+    /* That millisecond was busy, so the full interval applies now */
+    qtest_clock_step(qts, 1000 * 1000);
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(dev->bus->get_queue_isr_status(dev, vq));
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(!dev->bus->get_queue_isr_status(dev, vq));
+    qtest_clock_step(qts, 1000 * 1000);
+    qvirtio_wait_queue_isr(qts, dev, vq, QVIRTIO_BLK_TIMEOUT_US);
+
+    /* After an idle period, coalescing is off again */
+    qtest_clock_step(qts, 10 * 1000 * 1000);
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(dev->bus->get_queue_isr_status(dev, vq));
+    coalesce_request(dev, t_alloc, vq);
+    g_assert(dev->bus->get_queue_isr_status(dev, vq));
+
+    qvirtqueue_cleanup(dev->bus, vq, t_alloc);
+}
+
+/*
+ * The map cache tests run on the PC machine with two NUMA nodes, whose RAM
+ * blocks are adjacent at MAP_CACHE_NODE_SIZE.
+ */
+#define MAP_CACHE_NODE_SIZE     (64 * 1024 * 1024)
+#define MAP_CACHE_SPAN_ADDR     (MAP_CACHE_NODE_SIZE - 256)
+
+/* i440FX PAM register for 0xd0000-0xd7fff, and the region it controls */
+#define I440FX_PAM_D0000        0x5c
+#define I440FX_PAM_PCI          0x00
+#define I440FX_PAM_RAM          0x33
+#define MAP_CACHE_PAM_ADDR      0xd0000
+
+static bool map_cache_supported(void)
+{
+    const char *arch = qtest_get_arch();
+
+    return !strcmp(arch, "i386") || !strcmp(arch, "x86_64");
+}
+
+/* Transfer sector 0 with its data buffer at @data_addr */
+static void map_cache_request(QVirtioDevice *dev, QGuestAllocator *alloc,
+                              QVirtQueue *vq, uint32_t type,
+                              uint64_t data_addr)
+{
+    QTestState *qts = global_qtest;
+    QVirtioBlkReq req = {
+        .type = type,
+        .ioprio = 1,
+        .sector = 0,
+    };
+    uint64_t req_addr;
+    uint32_t free_head;
+    uint8_t status = 0xFF;
+
+    req_addr = guest_alloc(alloc, 17);
+    virtio_blk_fix_request(dev, &req);
+    memwrite(req_addr, &req, 16);
+    memwrite(req_addr + 16, &status, sizeof(status));
+
+    free_head = qvirtqueue_add(qts, vq, req_addr, 16, false, true);
+    qvirtqueue_add(qts, vq, data_addr, 512, type == VIRTIO_BLK_T_IN, true);
+    qvirtqueue_add(qts, vq, req_addr + 16, 1, true, false);
+    qvirtqueue_kick(qts, dev, vq, free_head);
+
+    qvirtio_wait_used_elem(qts, dev, vq, free_head, NULL,
+                           QVIRTIO_BLK_TIMEOUT_US);
+    g_assert_cmpint(readb(req_addr + 16), ==, 0);
+
+    guest_free(alloc, req_addr);
+}
+
+/* A buffer that starts in one RAM block and ends in the next */
+static void map_cache_span(void *obj, void *u_data, QGuestAllocator *t_alloc)
+{
+    QVirtioBlkPCI *blk = obj;
+    QVirtioDevice *dev = &blk->pci_vdev.vdev;
+    char data[512], buf[512];
+    uint64_t addr;
+    QVirtQueue *vq;
+
+    if (!map_cache_supported()) {
+        g_test_skip("needs the PC machine");
+        return;
+    }
+
+    vq = virtio_blk_setup_vq(dev, t_alloc);
+    addr = guest_alloc(t_alloc, sizeof(buf));
+    g_assert_cmphex(addr + sizeof(buf), <=, MAP_CACHE_SPAN_ADDR);
+
+    memset(data, 0xa5, 256);
+    memset(data + 256, 0x5a, 256);
+    memwrite(MAP_CACHE_SPAN_ADDR, data, sizeof(data));
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_OUT, MAP_CACHE_SPAN_ADDR);
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_IN, addr);
+    memread(addr, buf, sizeof(buf));
+    g_assert(!memcmp(buf, data, sizeof(buf)));
+
+    /* Now the part in the first block is cached */
+    memset(buf, 0, sizeof(buf));
+    memwrite(MAP_CACHE_SPAN_ADDR, buf, sizeof(buf));
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_IN, MAP_CACHE_SPAN_ADDR);
+    memread(MAP_CACHE_SPAN_ADDR, buf, sizeof(buf));
+    g_assert(!memcmp(buf, data, sizeof(buf)));
+
+    guest_free(t_alloc, addr);
+    qvirtqueue_cleanup(dev->bus, vq, t_alloc);
+}
+
+/*
+ * A buffer whose guest RAM is unmapped after it was used.  With 0xd0000
+ * routed to PCI, a read from the disk must not reach the RAM behind it.
+ */
+static void map_cache_remap(void *obj, void *u_data, QGuestAllocator *t_alloc)
+{
+    QVirtioBlkPCI *blk = obj;
+    QVirtioDevice *dev = &blk->pci_vdev.vdev;
+    QPCIDevice *host;
+    char data[512], buf[512];
+    uint64_t addr;
+    QVirtQueue *vq;
+
+    if (!map_cache_supported()) {
+        g_test_skip("needs the PC machine");
+        return;
+    }
+
+    vq = virtio_blk_setup_vq(dev, t_alloc);
+    host = qpci_device_find(blk->pci_vdev.pdev->bus, QPCI_DEVFN(0, 0));
+    g_assert_nonnull(host);
+    addr = guest_alloc(t_alloc, sizeof(buf));
+
+    memset(data, 0xa5, sizeof(data));
+    memwrite(addr, data, sizeof(data));
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_OUT, addr);
+
+    qpci_config_writeb(host, I440FX_PAM_D0000, I440FX_PAM_RAM);
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_IN, MAP_CACHE_PAM_ADDR);
+    memread(MAP_CACHE_PAM_ADDR, buf, sizeof(buf));
+    g_assert(!memcmp(buf, data, sizeof(buf)));
+
+    memset(buf, 0x5a, sizeof(buf));
+    memwrite(addr, buf, sizeof(buf));
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_OUT, addr);
+
+    qpci_config_writeb(host, I440FX_PAM_D0000, I440FX_PAM_PCI);
+    map_cache_request(dev, t_alloc, vq, VIRTIO_BLK_T_IN, MAP_CACHE_PAM_ADDR);
+
+    qpci_config_writeb(host, I440FX_PAM_D0000, I440FX_PAM_RAM);
+    memread(MAP_CACHE_PAM_ADDR, buf, sizeof(buf));
+    g_assert(!memcmp(buf, data, sizeof(buf)));
+
+    guest_free(t_alloc, addr);
+    g_free(host);
+    qvirtqueue_cleanup(dev->bus, vq, t_alloc);
+}
+
 static void pci_hotplug(void *obj, void *data, QGuestAllocator *t_alloc)
 {
     QVirtioPCIDevice *dev1 = obj;
@@ -785,6 +1055,18 @@ static void *virtio_blk_test_setup(GString *cmd_line, void *arg)
     return arg;
 }
 
+static void *virtio_blk_test_setup_numa(GString *cmd_line, void *arg)
+{
+    virtio_blk_test_setup(cmd_line, arg);
+    if (map_cache_supported()) {
+        g_string_append(cmd_line,
+                        " -object memory-backend-ram,id=ram0,size=64M"
+                        " -object memory-backend-ram,id=ram1,size=64M"
+                        " -numa node,memdev=ram0 -numa node,memdev=ram1 ");
+    }
+    return arg;
+}
+
 static void register_virtio_blk_test(void)
 {
     QOSGraphTestOptions opts = {
@@ -802,6 +1084,18 @@ static void register_virtio_blk_test(void)
     qos_add_test("nxvirtq", "virtio-blk-pci",
                       test_nonexistent_virtqueue, &opts);
     qos_add_test("hotplug", "virtio-blk-pci", pci_hotplug, &opts);
+
+    opts.edge.extra_device_opts = "coalesce-usecs=1000,coalesce-max-frames=3";
+    qos_add_test("coalesce", "virtio-blk-pci", coalesce, &opts);
+    opts.edge.extra_device_opts = "coalesce-usecs=1000,coalesce-adaptive=on";
+    qos_add_test("coalesce-adaptive", "virtio-blk-pci", coalesce_adaptive,
+                 &opts);
+    opts.edge.extra_device_opts = NULL;
+
+    opts.before = virtio_blk_test_setup_numa;
+    qos_add_test("map-cache/span", "virtio-blk-pci", map_cache_span, &opts);
+    opts.before = virtio_blk_test_setup;
+    qos_add_test("map-cache/remap", "virtio-blk-pci", map_cache_remap, &opts);
 }
 
 libqos_init(register_virtio_blk_test);
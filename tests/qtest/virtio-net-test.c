@@ -9,6 +9,7 @@
 
 #include "qemu/osdep.h"
 #include "libqtest-single.h"
+#include "qemu/bswap.h"
 #include "qemu/iov.h"
 #include "qemu/module.h"
 #include "qapi/qmp/qdict.h"
@@ -165,6 +166,484 @@ static void stop_cont_test(void *obj, void *data, QGuestAllocator *t_alloc)
     rx_stop_cont_test(dev, t_alloc, rx, sv[0]);
 }
 
+#define RX_BATCH_PKTS 32
+
+/*
+ * Queue several packets in QEMU while the guest has no receive buffers,
+ * then make buffers for all of them available with a single notification
+ * so that they are flushed to the device as one batch.
+ */
+static void rx_batch_test(void *obj, void *data, QGuestAllocator *t_alloc)
+{
+    QVirtioNet *net_if = obj;
+    QVirtioDevice *dev = net_if->vdev;
+    QVirtQueue *vq = net_if->queues[0];
+    QTestState *qts = global_qtest;
+    int *sv = data;
+    char test[RX_BATCH_PKTS][8];
+    int len[RX_BATCH_PKTS];
+    struct iovec iov[RX_BATCH_PKTS * 2];
+    uint64_t req_addr[RX_BATCH_PKTS];
+    uint32_t free_head[RX_BATCH_PKTS];
+    uint32_t desc_idx;
+    char buffer[64];
+    QDict *rsp;
+    gint64 start;
+    int i, ret;
+
+    for (i = 0; i < RX_BATCH_PKTS; i++) {
+        snprintf(test[i], sizeof(test[i]), "TEST%02d", i);
+        len[i] = htonl(sizeof(test[i]));
+        iov[i * 2].iov_base = &len[i];
+        iov[i * 2].iov_len = sizeof(len[i]);
+        iov[i * 2 + 1].iov_base = test[i];
+        iov[i * 2 + 1].iov_len = sizeof(test[i]);
+    }
+
+    ret = iov_send(sv[0], iov, ARRAY_SIZE(iov), 0,
+                   RX_BATCH_PKTS * (sizeof(len[0]) + sizeof(test[0])));
+    g_assert_cmpint(ret, ==,
+                    RX_BATCH_PKTS * (sizeof(len[0]) + sizeof(test[0])));
+
+    /* Let QEMU read the packets and queue them, as there are no buffers */
+    rsp = qmp("{ 'execute' : 'query-status'}");
+    qobject_unref(rsp);
+
+    for (i = 0; i < RX_BATCH_PKTS; i++) {
+        req_addr[i] = guest_alloc(t_alloc, 64);
+        free_head[i] = qvirtqueue_add(qts, vq, req_addr[i], 64, true, false);
+    }
+
+    qvirtqueue_kick_batch(qts, dev, vq, free_head, RX_BATCH_PKTS);
+
+    for (i = 0; i < RX_BATCH_PKTS; i++) {
+        start = g_get_monotonic_time();
+        while (!qvirtqueue_get_buf(qts, vq, &desc_idx, NULL)) {
+            qtest_clock_step(qts, 100);
+            g_assert(g_get_monotonic_time() - start <= QVIRTIO_NET_TIMEOUT_US);
+        }
+        g_assert_cmpint(desc_idx, ==, free_head[i]);
+
+        memread(req_addr[i] + VNET_HDR_SIZE, buffer, sizeof(test[i]));
+        g_assert_cmpstr(buffer, ==, test[i]);
+        guest_free(t_alloc, req_addr[i]);
+    }
+}
+
+#define TX_BATCH_PKTS   36
+#define TX_BATCH_LEN    1400
+
+/*
+ * Runs with a small socket send buffer in QEMU.  virtio-net pops the
+ * packets in two full batches and a partial one, and the backend only
+ * takes a few of them at a time, so the TX path goes asynchronous in the
+ * middle of a batch and hands the rest of it back to the virtqueue.  All
+ * packets must still be sent in order, and all buffers used.
+ */
+static void tx_batch_test(void *obj, void *data, QGuestAllocator *t_alloc)
+{
+    QVirtioNet *net_if = obj;
+    QVirtioDevice *dev = net_if->vdev;
+    QVirtQueue *vq = net_if->queues[1];
+    QTestState *qts = global_qtest;
+    uint8_t hdr[VNET_HDR_SIZE] = { 0 };
+    uint8_t pkt[TX_BATCH_LEN], frame[TX_BATCH_LEN];
+    uint64_t req_addr[TX_BATCH_PKTS];
+    uint32_t free_head[TX_BATCH_PKTS];
+    uint32_t desc_idx, len;
+    int *sv = data;
+    gint64 start;
+    int i, ret;
+
+    for (i = 0; i < TX_BATCH_PKTS; i++) {
+        req_addr[i] = guest_alloc(t_alloc, VNET_HDR_SIZE + TX_BATCH_LEN);
+        memset(pkt, i, sizeof(pkt));
+        memwrite(req_addr[i], hdr, sizeof(hdr));
+        memwrite(req_addr[i] + VNET_HDR_SIZE, pkt, sizeof(pkt));
+        free_head[i] = qvirtqueue_add(qts, vq, req_addr[i],
+                                      VNET_HDR_SIZE + TX_BATCH_LEN,
+                                      false, false);
+    }
+
+    qvirtqueue_kick_batch(qts, dev, vq, free_head, TX_BATCH_PKTS);
+
+    for (i = 0; i < TX_BATCH_PKTS; i++) {
+        ret = recv(sv[0], &len, sizeof(len), MSG_WAITALL);
+        g_assert_cmpint(ret, ==, sizeof(len));
+        g_assert_cmpuint(ntohl(len), ==, TX_BATCH_LEN);
+        ret = recv(sv[0], frame, TX_BATCH_LEN, MSG_WAITALL);
+        g_assert_cmpint(ret, ==, TX_BATCH_LEN);
+
+        memset(pkt, i, sizeof(pkt));
+        g_assert(!memcmp(frame, pkt, TX_BATCH_LEN));
+    }
+
+    for (i = 0; i < TX_BATCH_PKTS; i++) {
+        start = g_get_monotonic_time();
+        while (!qvirtqueue_get_buf(qts, vq, &desc_idx, NULL)) {
+            g_assert(g_get_monotonic_time() - start <= QVIRTIO_NET_TIMEOUT_US);
+        }
+        g_assert_cmpint(desc_idx, ==, free_head[i]);
+        guest_free(t_alloc, req_addr[i]);
+    }
+}
+
+#define TX_WRAP_ROUND   100
+#define TX_WRAP_LEN     64
+
+/*
+ * Move the guest's avail index past 65535, in the middle of a batch that
+ * virtio-net pops.  All descriptors point to the same packet, and the
+ * chain made available at index i is always head i % queue size.
+ */
+static void tx_wrap_test(void *obj, void *data, QGuestAllocator *t_alloc)
+{
+    QVirtioNet *net_if = obj;
+    QVirtioDevice *dev = net_if->vdev;
+    QVirtQueue *vq = net_if->queues[1];
+    QTestState *qts = global_qtest;
+    uint8_t pkt[VNET_HDR_SIZE + TX_WRAP_LEN] = { 0 };
+    uint8_t frame[TX_WRAP_LEN];
+    uint32_t free_head[TX_WRAP_ROUND];
+    uint32_t desc_idx, len;
+    uint64_t req_addr;
+    uint32_t idx;
+    int *sv = data;
+    gint64 start;
+    int i, ret;
+
+    g_assert_cmpint(vq->size, >=, TX_WRAP_ROUND);
+
+    memset(pkt + VNET_HDR_SIZE, 0x5a, TX_WRAP_LEN);
+    req_addr = guest_alloc(t_alloc, sizeof(pkt));
+    memwrite(req_addr, pkt, sizeof(pkt));
+    for (i = 0; i < vq->size; i++) {
+        g_assert_cmpint(qvirtqueue_add(qts, vq, req_addr, sizeof(pkt),
+                                       false, false), ==, i);
+    }
+
+    for (idx = 0; idx <= 0x10000; idx += TX_WRAP_ROUND) {
+        for (i = 0; i < TX_WRAP_ROUND; i++) {
+            free_head[i] = (idx + i) % vq->size;
+        }
+        qvirtqueue_kick_batch(qts, dev, vq, free_head, TX_WRAP_ROUND);
+
+        for (i = 0; i < TX_WRAP_ROUND; i++) {
+            ret = recv(sv[0], &len, sizeof(len), MSG_WAITALL);
+            g_assert_cmpint(ret, ==, sizeof(len));
+            g_assert_cmpuint(ntohl(len), ==, TX_WRAP_LEN);
+            ret = recv(sv[0], frame, TX_WRAP_LEN, MSG_WAITALL);
+            g_assert_cmpint(ret, ==, TX_WRAP_LEN);
+            g_assert(!memcmp(frame, pkt + VNET_HDR_SIZE, TX_WRAP_LEN));
+        }
+
+        for (i = 0; i < TX_WRAP_ROUND; i++) {
+            start = g_get_monotonic_time();
+            while (!qvirtqueue_get_buf(qts, vq, &desc_idx, NULL)) {
+                g_assert(g_get_monotonic_time() - start <=
+                         QVIRTIO_NET_TIMEOUT_US);
+            }
+            g_assert_cmpint(desc_idx, ==, free_head[i]);
+        }
+    }
+
+    guest_free(t_alloc, req_addr);
+}
+
+/*
+ * Software segmentation with x-sw-gso=on.  The socket backend takes no
+ * vnet header, so every offload the guest asks for is done by virtio-net.
+ */
+#define SW_GSO_MSS          1000
+#define SW_GSO_SEQ          0x10000
+#define SW_GSO_IP_ID        0x1234
+#define SW_GSO_ETH_LEN      14
+#define SW_GSO_IP4_LEN      20
+#define SW_GSO_IP6_LEN      40
+#define SW_GSO_TCP_LEN      20
+#define SW_GSO_UDP_LEN      8
+#define SW_GSO_MAX_FRAME    (SW_GSO_ETH_LEN + 65535)
+
+#define SW_GSO_ETH_P_IP     0x0800
+#define SW_GSO_ETH_P_IPV6   0x86dd
+#define SW_GSO_PROTO_TCP    6
+#define SW_GSO_PROTO_UDP    17
+
+static uint8_t sw_gso_payload_byte(size_t off)
+{
+    return off * 7;
+}
+
+static uint32_t sw_gso_csum_add(uint32_t sum, const uint8_t *buf, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i + 1 < len; i += 2) {
+        sum += buf[i] << 8 | buf[i + 1];
+    }
+    if (len & 1) {
+        sum += buf[len - 1] << 8;
+    }
+    return sum;
+}
+
+static uint16_t sw_gso_csum_fold(uint32_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return sum;
+}
+
+/* Build an Ethernet frame of one TCP or UDP packet; returns its length */
+static size_t sw_gso_build(uint8_t *frame, bool ipv6, uint8_t proto,
+                           size_t payload, size_t *l4_off)
+{
+    size_t l4_len = (proto == SW_GSO_PROTO_TCP ? SW_GSO_TCP_LEN :
+                                                 SW_GSO_UDP_LEN) + payload;
+    uint8_t *l3 = frame + SW_GSO_ETH_LEN;
+    uint8_t *l4;
+    size_t i;
+
+    memset(frame, 0, SW_GSO_ETH_LEN + SW_GSO_IP6_LEN + l4_len);
+    memcpy(frame, "\x52\x54\x00\x12\x34\x57\x52\x54\x00\x12\x34\x56", 12);
+
+    if (ipv6) {
+        stw_be_p(frame + 12, SW_GSO_ETH_P_IPV6);
+        l3[0] = 0x60;
+        stw_be_p(l3 + 4, l4_len);
+        l3[6] = proto;
+        l3[7] = 64;
+        l3[23] = 1;
+        l3[39] = 2;
+        *l4_off = SW_GSO_ETH_LEN + SW_GSO_IP6_LEN;
+    } else {
+        stw_be_p(frame + 12, SW_GSO_ETH_P_IP);
+        l3[0] = 0x45;
+        stw_be_p(l3 + 2, SW_GSO_IP4_LEN + l4_len);
+        stw_be_p(l3 + 4, SW_GSO_IP_ID);
+        l3[8] = 64;
+        l3[9] = proto;
+        stl_be_p(l3 + 12, 0x0a000001);
+        stl_be_p(l3 + 16, 0x0a000002);
+        stw_be_p(l3 + 10, ~sw_gso_csum_fold(sw_gso_csum_add(0, l3,
+                                                            SW_GSO_IP4_LEN)));
+        *l4_off = SW_GSO_ETH_LEN + SW_GSO_IP4_LEN;
+    }
+
+    l4 = frame + *l4_off;
+    stw_be_p(l4, 5001);
+    stw_be_p(l4 + 2, 40000);
+    if (proto == SW_GSO_PROTO_TCP) {
+        stl_be_p(l4 + 4, SW_GSO_SEQ);
+        stl_be_p(l4 + 8, 1);
+        l4[12] = (SW_GSO_TCP_LEN / 4) << 4;
+        l4[13] = 0x10;  /* ACK */
+        stw_be_p(l4 + 14, 512);
+    } else {
+        stw_be_p(l4 + 4, l4_len);
+    }
+    for (i = 0; i < payload; i++) {
+        l4[l4_len - payload + i] = sw_gso_payload_byte(i);
+    }
+
+    return *l4_off + l4_len;
+}
+
+/*
+ * Put @frame on the TX queue behind a virtio-net header that asks for
+ * @gso_type with segments of @gso_size bytes and for the @proto checksum
+ * to be filled in.  Returns the head descriptor, the buffer is in *@addr.
+ */
+static uint32_t sw_gso_send(QVirtioDevice *dev, QGuestAllocator *alloc,
+                            QVirtQueue *vq, const uint8_t *frame, size_t len,
+                            size_t l4_off, uint8_t proto, uint8_t gso_type,
+                            uint16_t gso_size, uint64_t *addr)
+{
+    QTestState *qts = global_qtest;
+    uint8_t hdr[VNET_HDR_SIZE] = { VIRTIO_NET_HDR_F_NEEDS_CSUM, gso_type };
+    bool udp = proto == SW_GSO_PROTO_UDP;
+    uint32_t free_head;
+
+    stw_le_p(hdr + 2, l4_off + (udp ? SW_GSO_UDP_LEN : SW_GSO_TCP_LEN));
+    stw_le_p(hdr + 4, gso_size);
+    stw_le_p(hdr + 6, l4_off);
+    stw_le_p(hdr + 8, udp ? 6 : 16);
+
+    *addr = guest_alloc(alloc, VNET_HDR_SIZE + len);
+    memwrite(*addr, hdr, VNET_HDR_SIZE);
+    memwrite(*addr + VNET_HDR_SIZE, frame, len);
+
+    free_head = qvirtqueue_add(qts, vq, *addr, VNET_HDR_SIZE + len,
+                               false, false);
+    qvirtqueue_kick(qts, dev, vq, free_head);
+    return free_head;
+}
+
+/* Receive one frame from the socket backend; returns its length */
+static size_t sw_gso_recv(int socket, uint8_t *frame)
+{
+    uint32_t len;
+    ssize_t ret;
+
+    ret = recv(socket, &len, sizeof(len), MSG_WAITALL);
+    g_assert_cmpint(ret, ==, sizeof(len));
+    len = ntohl(len);
+    g_assert_cmpuint(len, <=, SW_GSO_MAX_FRAME);
+
+    ret = recv(socket, frame, len, MSG_WAITALL);
+    g_assert_cmpint(ret, ==, len);
+    return len;
+}
+
+/*
+ * Check that @frame is segment @seg of a packet built by sw_gso_build()
+ * with @payload bytes, cut into @mss byte segments, and that its IPv4 and
+ * L4 checksums are valid.
+ */
+static void sw_gso_check(const uint8_t *frame, size_t len, bool ipv6,
+                         uint8_t proto, size_t payload, size_t mss, int seg)
+{
+    size_t l4_off = SW_GSO_ETH_LEN + (ipv6 ? SW_GSO_IP6_LEN : SW_GSO_IP4_LEN);
+    size_t l4_hdr = proto == SW_GSO_PROTO_TCP ? SW_GSO_TCP_LEN :
+                                                SW_GSO_UDP_LEN;
+    size_t seg_len = MIN(mss, payload - seg * mss);
+    size_t l4_len = l4_hdr + seg_len;
+    const uint8_t *l3 = frame + SW_GSO_ETH_LEN;
+    const uint8_t *l4 = frame + l4_off;
+    uint32_t sum;
+    size_t i;
+
+    g_assert_cmpuint(len, ==, l4_off + l4_len);
+
+    if (ipv6) {
+        g_assert_cmpuint(lduw_be_p(l3 + 4), ==, l4_len);
+        sum = sw_gso_csum_add(0, l3 + 8, 32);
+    } else {
+        g_assert_cmpuint(lduw_be_p(l3 + 2), ==, SW_GSO_IP4_LEN + l4_len);
+        g_assert_cmpuint(lduw_be_p(l3 + 4), ==, SW_GSO_IP_ID + seg);
+        g_assert_cmphex(sw_gso_csum_fold(sw_gso_csum_add(0, l3,
+                                                         SW_GSO_IP4_LEN)),
+                        ==, 0xffff);
+        sum = sw_gso_csum_add(0, l3 + 12, 8);
+    }
+    sum += proto + l4_len;
+    g_assert_cmphex(sw_gso_csum_fold(sw_gso_csum_add(sum, l4, l4_len)),
+                    ==, 0xffff);
+
+    if (proto == SW_GSO_PROTO_TCP) {
+        g_assert_cmpuint(ldl_be_p(l4 + 4), ==, SW_GSO_SEQ + seg * mss);
+    } else {
+        g_assert_cmpuint(lduw_be_p(l4 + 4), ==, l4_len);
+    }
+    for (i = 0; i < seg_len; i++) {
+        g_assert_cmpuint(l4[l4_hdr + i], ==,
+                         sw_gso_payload_byte(seg * mss + i));
+    }
+}
+
+/* Send a packet of @payload bytes and check the segments that come out */
+static void sw_gso_test_one(QVirtioDevice *dev, QGuestAllocator *alloc,
+                            QVirtQueue *vq, int socket, bool ipv6,
+                            uint8_t proto, uint8_t gso_type, size_t payload)
+{
+    QTestState *qts = global_qtest;
+    g_autofree uint8_t *frame = g_malloc(SW_GSO_MAX_FRAME);
+    size_t mss = gso_type == VIRTIO_NET_HDR_GSO_NONE ? payload : SW_GSO_MSS;
+    size_t len, l4_off;
+    uint32_t free_head;
+    uint64_t addr;
+    int seg;
+
+    len = sw_gso_build(frame, ipv6, proto, payload, &l4_off);
+    free_head = sw_gso_send(dev, alloc, vq, frame, len, l4_off, proto,
+                            gso_type,
+                            gso_type == VIRTIO_NET_HDR_GSO_NONE ? 0 : mss,
+                            &addr);
+
+    for (seg = 0; seg * mss < payload; seg++) {
+        len = sw_gso_recv(socket, frame);
+        sw_gso_check(frame, len, ipv6, proto, payload, mss, seg);
+    }
+
+    qvirtio_wait_used_elem(qts, dev, vq, free_head, NULL,
+                           QVIRTIO_NET_TIMEOUT_US);
+    guest_free(alloc, addr);
+}
+
+/* Runs with x-sw-gso=on,host_uso=on */
+static void sw_gso_test(void *obj, void *data, QGuestAllocator *t_alloc)
+{
+    QVirtioNet *net_if = obj;
+    QVirtioDevice *dev = net_if->vdev;
+    QVirtQueue *tx = net_if->queues[1];
+    int *sv = data;
+    size_t payload = 2 * SW_GSO_MSS + SW_GSO_MSS / 2;
+
+    /* Checksum offload only */
+    sw_gso_test_one(dev, t_alloc, tx, sv[0], false, SW_GSO_PROTO_TCP,
+                    VIRTIO_NET_HDR_GSO_NONE, payload);
+    sw_gso_test_one(dev, t_alloc, tx, sv[0], true, SW_GSO_PROTO_UDP,
+                    VIRTIO_NET_HDR_GSO_NONE, payload);
+
+    /* TSO, with a shorter last segment */
+    sw_gso_test_one(dev, t_alloc, tx, sv[0], false, SW_GSO_PROTO_TCP,
+                    VIRTIO_NET_HDR_GSO_TCPV4, payload);
+    sw_gso_test_one(dev, t_alloc, tx, sv[0], true, SW_GSO_PROTO_TCP,
+                    VIRTIO_NET_HDR_GSO_TCPV6, payload);
+
+    /* USO */
+    g_assert(dev->bus->get_guest_features(dev) &
+             (1ull << VIRTIO_NET_F_HOST_USO));
+    sw_gso_test_one(dev, t_alloc, tx, sv[0], false, SW_GSO_PROTO_UDP,
+                    VIRTIO_NET_HDR_GSO_UDP_L4, payload);
+    sw_gso_test_one(dev, t_alloc, tx, sv[0], true, SW_GSO_PROTO_UDP,
+                    VIRTIO_NET_HDR_GSO_UDP_L4, payload);
+}
+
+#define SW_GSO_BP_SEGS      64
+
+/*
+ * Runs with x-sw-gso=on and a small socket send buffer in QEMU, so that
+ * the backend cannot take all segments of a packet at once.  The packet
+ * must not be completed before the last of them has been sent.
+ */
+static void sw_gso_backpressure_test(void *obj, void *data,
+                                     QGuestAllocator *t_alloc)
+{
+    QVirtioNet *net_if = obj;
+    QVirtioDevice *dev = net_if->vdev;
+    QVirtQueue *tx = net_if->queues[1];
+    QTestState *qts = global_qtest;
+    g_autofree uint8_t *frame = g_malloc(SW_GSO_MAX_FRAME);
+    size_t payload = SW_GSO_BP_SEGS * SW_GSO_MSS;
+    size_t len, l4_off;
+    uint32_t free_head, desc_idx;
+    uint64_t addr;
+    int *sv = data;
+    int seg;
+
+    len = sw_gso_build(frame, false, SW_GSO_PROTO_TCP, payload, &l4_off);
+    free_head = sw_gso_send(dev, t_alloc, tx, frame, len, l4_off,
+                            SW_GSO_PROTO_TCP, VIRTIO_NET_HDR_GSO_TCPV4,
+                            SW_GSO_MSS, &addr);
+
+    /* Once the first segment arrives, the rest is queued in QEMU */
+    len = sw_gso_recv(sv[0], frame);
+    sw_gso_check(frame, len, false, SW_GSO_PROTO_TCP, payload, SW_GSO_MSS, 0);
+    g_assert(!qvirtqueue_get_buf(qts, tx, &desc_idx, NULL));
+
+    for (seg = 1; seg < SW_GSO_BP_SEGS; seg++) {
+        len = sw_gso_recv(sv[0], frame);
+        sw_gso_check(frame, len, false, SW_GSO_PROTO_TCP, payload,
+                     SW_GSO_MSS, seg);
+    }
+
+    qvirtio_wait_used_elem(qts, dev, tx, free_head, NULL,
+                           QVIRTIO_NET_TIMEOUT_US);
+    guest_free(t_alloc, addr);
+}
+
 static void hotplug(void *obj, void *data, QGuestAllocator *t_alloc)
 {
     QVirtioPCIDevice *dev = obj;
@@ -284,6 +763,17 @@ static void *virtio_net_test_setup(GString *cmd_line, void *arg)
     return sv;
 }
 
+static void *virtio_net_test_setup_small_sndbuf(GString *cmd_line, void *arg)
+{
+    int *sv = virtio_net_test_setup(cmd_line, arg);
+    int sndbuf = 4096;
+    int ret;
+
+    ret = setsockopt(sv[1], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+    g_assert_cmpint(ret, ==, 0);
+    return sv;
+}
+
 #endif /* _WIN32 */
 
 static void large_tx(void *obj, void *data, QGuestAllocator *t_alloc)
@@ -326,7 +816,18 @@ static void register_virtio_net_test(void)
     qos_add_test("hotplug", "virtio-net-pci", hotplug, &opts);
     qos_add_test("basic", "virtio-net", send_recv_test, &opts);
     qos_add_test("rx_stop_cont", "virtio-net", stop_cont_test, &opts);
+    qos_add_test("rx_batch", "virtio-net", rx_batch_test, &opts);
+    qos_add_test("tx_wrap", "virtio-net", tx_wrap_test, &opts);
     qos_add_test("announce-self", "virtio-net", announce_self, &opts);
+
+    opts.edge.extra_device_opts = "x-sw-gso=on,host_uso=on";
+    qos_add_test("sw-gso", "virtio-net", sw_gso_test, &opts);
+    opts.before = virtio_net_test_setup_small_sndbuf;
+    opts.edge.extra_device_opts = "x-sw-gso=on";
+    qos_add_test("sw-gso/backpressure", "virtio-net",
+                 sw_gso_backpressure_test, &opts);
+    opts.edge.extra_device_opts = NULL;
+    qos_add_test("tx_batch", "virtio-net", tx_batch_test, &opts);
 #endif
 
     /* These tests do not need a loopback backend.  */
@@ -0,0 +1,150 @@
+/*
+ * Stress concurrent guest memory management.
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Several mutator threads repeatedly mprotect() their own private
+ * region, while checker threads pass a separate, always readable buffer
+ * to write(), which makes the emulator validate the guest range on every
+ * call. None of the threads touch each other's memory, so any slowdown
+ * as threads are added comes from serialisation inside the emulator.
+ * The time taken and the resulting rates are printed as a benchmark.
+ */
+#include <assert.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#define N_MUTATORS 4
+#define N_CHECKERS 4
+#define REGION_PAGES 16
+#define ITERATIONS 5000
+
+struct context {
+    int pagesize;
+    int dev_null_fd;
+    char *buf;
+    volatile int mutator_count;
+};
+
+struct mutator {
+    struct context *ctx;
+    char *region;
+};
+
+static void *thread_mutate(void *arg)
+{
+    struct mutator *m = arg;
+    size_t len = (size_t)REGION_PAGES * m->ctx->pagesize;
+    int i, ret;
+
+    for (i = 0; i < ITERATIONS; i++) {
+        /*
+         * Alternate between protecting a half and a quarter of the region,
+         * splitting and merging the emulator's view of it, and store to
+         * the part that stays writable.
+         */
+        size_t plen = (i & 1) ? len / 2 : len / 4;
+
+        ret = mprotect(m->region, plen, PROT_READ);
+        assert(ret == 0);
+        m->region[len - 1] = i;
+        ret = mprotect(m->region, len, PROT_READ | PROT_WRITE);
+        assert(ret == 0);
+        m->region[0] = i;
+    }
+
+    __atomic_fetch_sub(&m->ctx->mutator_count, 1, __ATOMIC_SEQ_CST);
+    return NULL;
+}
+
+static void *thread_check(void *arg)
+{
+    struct context *ctx = arg;
+    unsigned long n = 0;
+    ssize_t sret;
+
+    while (__atomic_load_n(&ctx->mutator_count, __ATOMIC_SEQ_CST)) {
+        sret = write(ctx->dev_null_fd, ctx->buf, ctx->pagesize);
+        assert(sret == ctx->pagesize);
+        n++;
+    }
+    return (void *)n;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+    pthread_t mutators[N_MUTATORS], checkers[N_CHECKERS];
+    struct mutator m[N_MUTATORS];
+    struct context ctx;
+    unsigned long checks = 0;
+    double start, elapsed;
+    int i, ret;
+
+    ctx.pagesize = getpagesize();
+    ctx.dev_null_fd = open("/dev/null", O_WRONLY);
+    assert(ctx.dev_null_fd >= 0);
+    ctx.buf = mmap(NULL, ctx.pagesize, PROT_READ | PROT_WRITE,
+                   MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    assert(ctx.buf != MAP_FAILED);
+    memset(ctx.buf, 'x', ctx.pagesize);
+    ctx.mutator_count = N_MUTATORS;
+
+    for (i = 0; i < N_MUTATORS; i++) {
+        m[i].ctx = &ctx;
+        m[i].region = mmap(NULL, (size_t)REGION_PAGES * ctx.pagesize,
+                           PROT_READ | PROT_WRITE,
+                           MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+        assert(m[i].region != MAP_FAILED);
+    }
+
+    start = now();
+    for (i = 0; i < N_CHECKERS; i++) {
+        ret = pthread_create(&checkers[i], NULL, thread_check, &ctx);
+        assert(ret == 0);
+    }
+    for (i = 0; i < N_MUTATORS; i++) {
+        ret = pthread_create(&mutators[i], NULL, thread_mutate, &m[i]);
+        assert(ret == 0);
+    }
+
+    for (i = 0; i < N_MUTATORS; i++) {
+        ret = pthread_join(mutators[i], NULL);
+        assert(ret == 0);
+    }
+    for (i = 0; i < N_CHECKERS; i++) {
+        void *n;
+
+        ret = pthread_join(checkers[i], &n);
+        assert(ret == 0);
+        checks += (unsigned long)n;
+    }
+    elapsed = now() - start;
+
+    printf("%d mutators, %d checkers: %.3f s, "
+           "%.0f mprotect/s, %.0f checked writes/s\n",
+           N_MUTATORS, N_CHECKERS, elapsed,
+           2.0 * N_MUTATORS * ITERATIONS / elapsed, checks / elapsed);
+
+    for (i = 0; i < N_MUTATORS; i++) {
+        ret = munmap(m[i].region, (size_t)REGION_PAGES * ctx.pagesize);
+        assert(ret == 0);
+    }
+    munmap(ctx.buf, ctx.pagesize);
+    close(ctx.dev_null_fd);
+
+    return EXIT_SUCCESS;
+}
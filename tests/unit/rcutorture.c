@@ -433,6 +433,121 @@ static void gtest_stress_10_5(void)
     gtest_stress(10, 5);
 }
 
+/*
+ * Check that grace periods are accounted for.
+ */
+
+static void gtest_stats(void)
+{
+    RCUStats before, after;
+    uint64_t n_before = 0, n_after = 0;
+    int i;
+
+    rcu_get_stats(&before);
+    for (i = 0; i < 10; i++) {
+        synchronize_rcu();
+    }
+    rcu_get_stats(&after);
+
+    g_assert_cmpuint(after.grace_periods - before.grace_periods, >=, 10);
+    for (i = 0; i < RCU_GP_LATENCY_BUCKETS; i++) {
+        n_before += before.gp_latency[i];
+        n_after += after.gp_latency[i];
+    }
+    g_assert_cmpuint(n_after - n_before, >=, 10);
+}
+
+/*
+ * Check that a backlog of callbacks is accounted for, and that it expedites
+ * the next grace period by forcing readers out of their critical sections.
+ */
+
+static QemuEvent gate_entered, gate_open, reader_ready, callbacks_done;
+static struct rcu_head gate_head, backlog_heads[RCU_CALL_EXPEDITE_SIZE];
+static int backlog_pending;
+static bool reader_forced;
+
+/* Keep the call_rcu thread busy while the backlog builds up */
+static void gate_cb(struct rcu_head *head)
+{
+    qemu_event_set(&gate_entered);
+    qemu_event_wait(&gate_open);
+}
+
+static void backlog_cb(struct rcu_head *head)
+{
+    if (qatomic_fetch_dec(&backlog_pending) == 1) {
+        qemu_event_set(&callbacks_done);
+    }
+}
+
+static void force_reader(Notifier *n, void *data)
+{
+    qatomic_set(&reader_forced, true);
+}
+
+static void *rcu_forced_reader(void *arg)
+{
+    Notifier force_rcu = { .notify = force_reader };
+
+    rcu_register_thread();
+    rcu_add_force_rcu_notifier(&force_rcu);
+
+    /* Only leave the critical section when asked to */
+    rcu_read_lock();
+    qemu_event_set(&reader_ready);
+    while (!qatomic_read(&reader_forced)) {
+        g_usleep(1000);
+    }
+    rcu_read_unlock();
+
+    rcu_remove_force_rcu_notifier(&force_rcu);
+    rcu_unregister_thread();
+    return NULL;
+}
+
+static void gtest_stats_backlog(void)
+{
+    RCUStats before, during, after;
+    int i;
+
+    qemu_event_init(&gate_entered, false);
+    qemu_event_init(&gate_open, false);
+    qemu_event_init(&reader_ready, false);
+    qemu_event_init(&callbacks_done, false);
+
+    rcu_get_stats(&before);
+    call_rcu1(&gate_head, gate_cb);
+    qemu_event_wait(&gate_entered);
+
+    create_thread(rcu_forced_reader);
+    qemu_event_wait(&reader_ready);
+
+    backlog_pending = RCU_CALL_EXPEDITE_SIZE;
+    for (i = 0; i < RCU_CALL_EXPEDITE_SIZE; i++) {
+        call_rcu1(&backlog_heads[i], backlog_cb);
+    }
+    rcu_get_stats(&during);
+    g_assert_cmpuint(during.backlog, >=, RCU_CALL_EXPEDITE_SIZE);
+
+    qemu_event_set(&gate_open);
+    qemu_event_wait(&callbacks_done);
+    wait_all_threads();
+    rcu_get_stats(&after);
+
+    g_assert(qatomic_read(&reader_forced));
+    g_assert_cmpuint(after.expedited_grace_periods -
+                     before.expedited_grace_periods, >=, 1);
+    g_assert_cmpuint(after.callbacks - before.callbacks,
+                     >=, RCU_CALL_EXPEDITE_SIZE + 1);
+    g_assert_cmpuint(after.max_batch, >=, RCU_CALL_EXPEDITE_SIZE);
+
+    qemu_event_destroy(&gate_entered);
+    qemu_event_destroy(&gate_open);
+    qemu_event_destroy(&reader_ready);
+    qemu_event_destroy(&callbacks_done);
+}
+
 /*
  * Mainprogram.
  */
@@ -452,6 +567,8 @@ int main(int argc, char *argv[])
     qemu_mutex_init(&counts_mutex);
     if (argc >= 2 && argv[1][0] == '-') {
         g_test_init(&argc, &argv, NULL);
+        g_test_add_func("/rcu/stats", gtest_stats);
+        g_test_add_func("/rcu/backlog", gtest_stats_backlog);
         if (g_test_quick()) {
             g_test_add_func("/rcu/torture/1reader", gtest_stress_1_1);
             g_test_add_func("/rcu/torture/10readers", gtest_stress_10_1);
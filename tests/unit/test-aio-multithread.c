@@ -431,6 +431,128 @@ static void test_multi_mutex_10(void)
     test_multi_mutex(NUM_CONTEXTS, 10);
 }
 
+/*
+ * Event loop wakeups.  A token is passed around the iothreads through event
+ * notifiers, while each AioContext also monitors many idle file descriptors.
+ * This compares file descriptor monitoring implementations.
+ */
+
+/* Enough for fdmon-poll to switch to fdmon-epoll, if it was set up */
+#define NUM_IDLE_NOTIFIERS 64
+
+static EventNotifier token_notifiers[NUM_CONTEXTS];
+static EventNotifier idle_notifiers[NUM_CONTEXTS][NUM_IDLE_NOTIFIERS];
+static uint32_t token_passes;
+
+static void token_cb(EventNotifier *n)
+{
+    event_notifier_test_and_clear(n);
+    if (qatomic_mb_read(&now_stopping)) {
+        return;
+    }
+    qatomic_inc(&token_passes);
+    event_notifier_set(&token_notifiers[(id + 1) % NUM_CONTEXTS]);
+}
+
+static void idle_cb(EventNotifier *n)
+{
+    event_notifier_test_and_clear(n);
+}
+
+static void add_notifiers_cb(void *opaque)
+{
+    bool use_g_source = *(bool *)opaque;
+    int i;
+
+    if (use_g_source) {
+        /*
+         * This drops fdmon-io_uring, if present, in favor of fdmon-poll.
+         * fdmon-poll switches to fdmon-epoll once enough file descriptors
+         * are monitored, but only if epoll(7) was set up instead of
+         * io_uring when the AioContext was created.
+         */
+        aio_context_use_g_source(ctx[id]);
+    }
+
+    event_notifier_init(&token_notifiers[id], false);
+    aio_set_event_notifier(ctx[id], &token_notifiers[id], false,
+                           token_cb, NULL, NULL);
+    for (i = 0; i < NUM_IDLE_NOTIFIERS; i++) {
+        event_notifier_init(&idle_notifiers[id][i], false);
+        aio_set_event_notifier(ctx[id], &idle_notifiers[id][i], false,
+                               idle_cb, NULL, NULL);
+    }
+}
+
+static void remove_notifiers_cb(void *opaque)
+{
+    int i;
+
+    aio_set_event_notifier(ctx[id], &token_notifiers[id], false,
+                           NULL, NULL, NULL);
+    event_notifier_cleanup(&token_notifiers[id]);
+    for (i = 0; i < NUM_IDLE_NOTIFIERS; i++) {
+        aio_set_event_notifier(ctx[id], &idle_notifiers[id][i], false,
+                               NULL, NULL, NULL);
+        event_notifier_cleanup(&idle_notifiers[id][i]);
+    }
+}
+
+static void stop_cb(void *opaque)
+{
+    /* Nothing to do, token_cb() cannot be running in this thread anymore */
+}
+
+static void test_multi_notify(bool use_g_source, int seconds)
+{
+    int i;
+
+    token_passes = 0;
+    now_stopping = false;
+
+    create_aio_contexts();
+    for (i = 0; i < NUM_CONTEXTS; i++) {
+        ctx_run(i, add_notifiers_cb, &use_g_source);
+    }
+
+    event_notifier_set(&token_notifiers[0]);
+    g_usleep(seconds * 1000000);
+
+    /* Make sure that no iothread passes the token on before cleaning up */
+    qatomic_mb_set(&now_stopping, true);
+    for (i = 0; i < NUM_CONTEXTS; i++) {
+        ctx_run(i, stop_cb, NULL);
+    }
+    for (i = 0; i < NUM_CONTEXTS; i++) {
+        ctx_run(i, remove_notifiers_cb, NULL);
+    }
+
+    join_aio_contexts();
+    g_test_message("%s: %d wakeups/second",
+                   use_g_source ? "g-source" : "default",
+                   token_passes / seconds);
+}
+
+static void test_multi_notify_1(void)
+{
+    test_multi_notify(false, 1);
+}
+
+static void test_multi_notify_10(void)
+{
+    test_multi_notify(false, 10);
+}
+
+static void test_multi_notify_g_source_1(void)
+{
+    test_multi_notify(true, 1);
+}
+
+static void test_multi_notify_g_source_10(void)
+{
+    test_multi_notify(true, 10);
+}
+
 /* End of tests.  */
 
 int main(int argc, char **argv)
@@ -447,6 +569,9 @@ int main(int argc, char **argv)
         g_test_add_func("/aio/multi/mutex/mcs", test_multi_fair_mutex_1);
 #endif
         g_test_add_func("/aio/multi/mutex/pthread", test_multi_mutex_1);
+        g_test_add_func("/aio/multi/notify/default", test_multi_notify_1);
+        g_test_add_func("/aio/multi/notify/g-source",
+                        test_multi_notify_g_source_1);
     } else {
         g_test_add_func("/aio/multi/schedule", test_multi_co_schedule_10);
         g_test_add_func("/aio/multi/mutex/contended", test_multi_co_mutex_10);
@@ -455,6 +580,9 @@ int main(int argc, char **argv)
         g_test_add_func("/aio/multi/mutex/mcs", test_multi_fair_mutex_10);
 #endif
         g_test_add_func("/aio/multi/mutex/pthread", test_multi_mutex_10);
+        g_test_add_func("/aio/multi/notify/default", test_multi_notify_10);
+        g_test_add_func("/aio/multi/notify/g-source",
+                        test_multi_notify_g_source_10);
     }
     return g_test_run();
 }
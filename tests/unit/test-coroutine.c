@@ -449,6 +449,36 @@ static void test_lifecycle(void)
     g_assert(done); /* expect done to be true (second time) */
 }
 
+/*
+ * Check that terminated coroutines are reused from the pool
+ */
+
+static void test_pool(void)
+{
+    uint64_t hits, misses, new_hits, new_misses;
+    Coroutine *coroutine;
+    bool done;
+    int i;
+
+    qemu_coroutine_get_pool_stats(&hits, &misses);
+    for (i = 0; i < 128; i++) {
+        done = false;
+        coroutine = qemu_coroutine_create(set_and_exit, &done);
+        qemu_coroutine_enter(coroutine);
+        g_assert(done);
+    }
+    qemu_coroutine_get_pool_stats(&new_hits, &new_misses);
+
+    if (CONFIG_COROUTINE_POOL) {
+        /* only the first one may need a new stack */
+        g_assert_cmpint(new_misses - misses, <=, 1);
+        /* hits are published in batches of 64 */
+        g_assert_cmpint(new_hits - hits, >=, 64);
+    } else {
+        g_assert_cmpint(new_misses - misses, ==, 128);
+    }
+}
+
 
 #define RECORD_SIZE 10 /* Leave some room for expansion */
 struct coroutine_position {
@@ -650,6 +680,7 @@ int main(int argc, char **argv)
     }
 
     g_test_add_func("/basic/lifecycle", test_lifecycle);
+    g_test_add_func("/basic/pool", test_pool);
     g_test_add_func("/basic/yield", test_yield);
     g_test_add_func("/basic/nesting", test_nesting);
     g_test_add_func("/basic/self", test_self);
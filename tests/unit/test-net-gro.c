@@ -0,0 +1,278 @@
+/*
+ * Test userspace TCP receive coalescing
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "net/checksum.h"
+#include "net/gro.h"
+#include "standard-headers/linux/virtio_net.h"
+
+#define VNET_HDR_LEN    sizeof(struct virtio_net_hdr_mrg_rxbuf)
+#define L3_OFF          (VNET_HDR_LEN + sizeof(struct eth_header))
+#define IP4_TCP_OFF     (L3_OFF + sizeof(struct ip_header))
+#define IP6_TCP_OFF     (L3_OFF + sizeof(struct ip6_header))
+#define MSS             100
+#define SEQ             1000
+#define NPKTS           4
+
+static uint8_t pkt_data[NPKTS][IP6_TCP_OFF + sizeof(struct tcp_header) + MSS];
+static struct iovec pkts[NPKTS];
+static uint8_t buf[NET_GRO_BUF_SIZE(VNET_HDR_LEN)];
+
+static size_t tcp_off(int i)
+{
+    struct eth_header eth;
+
+    memcpy(&eth, pkt_data[i] + VNET_HDR_LEN, sizeof(eth));
+    return be16_to_cpu(eth.h_proto) == ETH_P_IP ? IP4_TCP_OFF : IP6_TCP_OFF;
+}
+
+static uint8_t payload_byte(uint32_t seq)
+{
+    return seq * 7;
+}
+
+/* Build segment @i of a flow, carrying @len bytes starting at @seq */
+static void build_segment(int i, bool ipv6, uint32_t seq, size_t len,
+                          uint16_t flags)
+{
+    uint8_t *p = pkt_data[i];
+    struct virtio_net_hdr hdr = {
+        .flags = VIRTIO_NET_HDR_F_DATA_VALID,
+        .gso_type = VIRTIO_NET_HDR_GSO_NONE,
+    };
+    struct eth_header eth = {
+        .h_dest = { 0x52, 0x54, 0x00, 0x12, 0x34, 0x56 },
+        .h_source = { 0x52, 0x54, 0x00, 0x12, 0x34, 0x57 },
+        .h_proto = cpu_to_be16(ipv6 ? ETH_P_IPV6 : ETH_P_IP),
+    };
+    struct tcp_header tcp = {
+        .th_sport = cpu_to_be16(5001),
+        .th_dport = cpu_to_be16(40000),
+        .th_seq = cpu_to_be32(seq),
+        .th_ack = cpu_to_be32(1),
+        .th_offset_flags = cpu_to_be16((sizeof(tcp) / 4) << 12 | flags),
+        .th_win = cpu_to_be16(512),
+    };
+    size_t off;
+    size_t j;
+
+    memset(p, 0, sizeof(pkt_data[i]));
+    memcpy(p, &hdr, sizeof(hdr));
+    memcpy(p + VNET_HDR_LEN, &eth, sizeof(eth));
+
+    if (ipv6) {
+        struct ip6_header ip6 = { 0 };
+
+        ip6.ip6_ctlun.ip6_un1.ip6_un1_flow = cpu_to_be32(6 << 28);
+        ip6.ip6_ctlun.ip6_un1.ip6_un1_plen = cpu_to_be16(sizeof(tcp) + len);
+        ip6.ip6_ctlun.ip6_un1.ip6_un1_nxt = IP_PROTO_TCP;
+        ip6.ip6_ctlun.ip6_un1.ip6_un1_hlim = 64;
+        ip6.ip6_src.__in6_u.__u6_addr8[15] = 1;
+        ip6.ip6_dst.__in6_u.__u6_addr8[15] = 2;
+        memcpy(p + L3_OFF, &ip6, sizeof(ip6));
+        off = IP6_TCP_OFF;
+    } else {
+        struct ip_header ip = {
+            .ip_ver_len = 0x45,
+            .ip_len = cpu_to_be16(sizeof(ip) + sizeof(tcp) + len),
+            .ip_off = cpu_to_be16(IP_DF),
+            .ip_ttl = 64,
+            .ip_p = IP_PROTO_TCP,
+            .ip_src = cpu_to_be32(0x0a000001),
+            .ip_dst = cpu_to_be32(0x0a000002),
+        };
+
+        ip.ip_sum = cpu_to_be16(net_raw_checksum((uint8_t *)&ip,
+                                                 sizeof(ip)));
+        memcpy(p + L3_OFF, &ip, sizeof(ip));
+        off = IP4_TCP_OFF;
+    }
+
+    memcpy(p + off, &tcp, sizeof(tcp));
+    off += sizeof(tcp);
+    for (j = 0; j < len; j++) {
+        p[off + j] = payload_byte(seq + j);
+    }
+
+    pkts[i].iov_base = p;
+    pkts[i].iov_len = off + len;
+}
+
+static void build_flow(bool ipv6)
+{
+    int i;
+
+    for (i = 0; i < NPKTS; i++) {
+        build_segment(i, ipv6, SEQ + i * MSS, MSS, TH_ACK);
+    }
+}
+
+/* Check that buf holds segments 0 .. @n - 1 of the flow, merged */
+static void check_merged(size_t size, int n, bool ipv6)
+{
+    struct virtio_net_hdr hdr;
+    struct tcp_header tcp;
+    size_t off = ipv6 ? IP6_TCP_OFF : IP4_TCP_OFF;
+    size_t j;
+
+    g_assert_cmpuint(size, ==, off + sizeof(tcp) + n * MSS);
+
+    memcpy(&hdr, buf, sizeof(hdr));
+    g_assert_cmpuint(hdr.flags, ==, VIRTIO_NET_HDR_F_DATA_VALID);
+    g_assert_cmpuint(hdr.gso_type, ==, ipv6 ? VIRTIO_NET_HDR_GSO_TCPV6 :
+                                              VIRTIO_NET_HDR_GSO_TCPV4);
+    g_assert_cmpuint(hdr.hdr_len, ==, off + sizeof(tcp) - VNET_HDR_LEN);
+    g_assert_cmpuint(hdr.gso_size, ==, MSS);
+
+    if (ipv6) {
+        struct ip6_header ip6;
+
+        memcpy(&ip6, buf + L3_OFF, sizeof(ip6));
+        g_assert_cmpuint(be16_to_cpu(ip6.ip6_ctlun.ip6_un1.ip6_un1_plen),
+                         ==, sizeof(tcp) + n * MSS);
+    } else {
+        struct ip_header ip;
+
+        memcpy(&ip, buf + L3_OFF, sizeof(ip));
+        g_assert_cmpuint(be16_to_cpu(ip.ip_len), ==,
+                         sizeof(ip) + sizeof(tcp) + n * MSS);
+        g_assert_cmpuint(net_raw_checksum((uint8_t *)&ip, sizeof(ip)),
+                         ==, 0);
+    }
+
+    memcpy(&tcp, buf + off, sizeof(tcp));
+    g_assert_cmpuint(be32_to_cpu(tcp.th_seq), ==, SEQ);
+
+    off += sizeof(tcp);
+    for (j = 0; j < n * MSS; j++) {
+        g_assert_cmpuint(buf[off + j], ==, payload_byte(SEQ + j));
+    }
+}
+
+static void test_merge(bool ipv6)
+{
+    size_t size;
+
+    build_flow(ipv6);
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, NPKTS);
+    check_merged(size, NPKTS, ipv6);
+}
+
+static void test_merge_ipv4(void)
+{
+    test_merge(false);
+}
+
+static void test_merge_ipv6(void)
+{
+    test_merge(true);
+}
+
+/* A shorter last segment ends the merged packet */
+static void test_short_tail(void)
+{
+    size_t size;
+
+    build_flow(false);
+    build_segment(2, false, SEQ + 2 * MSS, MSS / 2, TH_ACK);
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 3);
+    g_assert_cmpuint(size, ==,
+                     IP4_TCP_OFF + sizeof(struct tcp_header) + MSS * 5 / 2);
+}
+
+/* PSH ends the merged packet, which carries it */
+static void test_push(void)
+{
+    struct tcp_header tcp;
+    size_t size;
+
+    build_flow(false);
+    build_segment(1, false, SEQ + MSS, MSS, TH_ACK | TH_PUSH);
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 2);
+    check_merged(size, 2, false);
+
+    memcpy(&tcp, buf + IP4_TCP_OFF, sizeof(tcp));
+    g_assert_cmpuint(TCP_HEADER_FLAGS(&tcp), ==, TH_ACK | TH_PUSH);
+}
+
+static void test_out_of_order(void)
+{
+    size_t size;
+
+    build_flow(false);
+    build_segment(2, false, SEQ + 3 * MSS, MSS, TH_ACK);
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 2);
+    check_merged(size, 2, false);
+}
+
+static void test_other_flow(void)
+{
+    struct tcp_header tcp;
+    size_t size;
+
+    build_flow(false);
+    memcpy(&tcp, pkt_data[3] + tcp_off(3), sizeof(tcp));
+    tcp.th_sport = cpu_to_be16(5002);
+    memcpy(pkt_data[3] + tcp_off(3), &tcp, sizeof(tcp));
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 3);
+    check_merged(size, 3, false);
+}
+
+/* Nothing is merged when the first packet cannot start a merge */
+static void test_no_merge(void)
+{
+    struct virtio_net_hdr hdr;
+    size_t size = 0;
+
+    /* single packet */
+    build_flow(false);
+    g_assert_cmpint(net_gro_merge(pkts, 1, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 1);
+
+    /* offload disabled */
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, false, true,
+                                  buf, &size), ==, 1);
+    build_flow(true);
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, false,
+                                  buf, &size), ==, 1);
+
+    /* checksum not validated */
+    build_flow(false);
+    memcpy(&hdr, pkt_data[0], sizeof(hdr));
+    hdr.flags = 0;
+    memcpy(pkt_data[0], &hdr, sizeof(hdr));
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 1);
+
+    /* SYN */
+    build_flow(false);
+    build_segment(0, false, SEQ, MSS, TH_ACK | TH_SYN);
+    g_assert_cmpint(net_gro_merge(pkts, NPKTS, VNET_HDR_LEN, true, true,
+                                  buf, &size), ==, 1);
+
+    g_assert_cmpuint(size, ==, 0);
+}
+
+int main(int argc, char **argv)
+{
+    g_test_init(&argc, &argv, NULL);
+
+    g_test_add_func("/net/gro/merge-ipv4", test_merge_ipv4);
+    g_test_add_func("/net/gro/merge-ipv6", test_merge_ipv6);
+    g_test_add_func("/net/gro/short-tail", test_short_tail);
+    g_test_add_func("/net/gro/push", test_push);
+    g_test_add_func("/net/gro/out-of-order", test_out_of_order);
+    g_test_add_func("/net/gro/other-flow", test_other_flow);
+    g_test_add_func("/net/gro/no-merge", test_no_merge);
+
+    return g_test_run();
+}
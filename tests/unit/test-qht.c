@@ -251,10 +251,22 @@ static void test_resize(void)
     qht_test(QHT_MODE_AUTO_RESIZE);
 }
 
+static void test_partitioned(void)
+{
+    qht_test(QHT_MODE_PARTITIONED);
+}
+
+static void test_partitioned_resize(void)
+{
+    qht_test(QHT_MODE_PARTITIONED | QHT_MODE_AUTO_RESIZE);
+}
+
 int main(int argc, char *argv[])
 {
     g_test_init(&argc, &argv, NULL);
     g_test_add_func("/qht/mode/default", test_default);
     g_test_add_func("/qht/mode/resize", test_resize);
+    g_test_add_func("/qht/mode/partitioned", test_partitioned);
+    g_test_add_func("/qht/mode/partitioned-resize", test_partitioned_resize);
     return g_test_run();
 }
@@ -231,6 +231,42 @@ static void test_cancel_async(void)
     do_test_cancel(false);
 }
 
+static int noop_cb(void *opaque)
+{
+    return 0;
+}
+
+static void throughput_done_cb(void *opaque, int ret)
+{
+    int *inflight = opaque;
+
+    (*inflight)--;
+}
+
+static void perf_throughput(void)
+{
+    const unsigned int max = 200000;
+    const int depth = 64;
+    unsigned int submitted = 0;
+    int inflight = 0;
+    double duration;
+
+    g_test_timer_start();
+    while (submitted < max || inflight > 0) {
+        while (submitted < max && inflight < depth) {
+            thread_pool_submit_aio(pool, noop_cb, NULL,
+                                   throughput_done_cb, &inflight);
+            submitted++;
+            inflight++;
+        }
+        aio_poll(ctx, true);
+    }
+    duration = g_test_timer_elapsed();
+
+    g_test_message("Throughput %u requests, queue depth %d: %f s, %f ops/s",
+                   max, depth, duration, max / duration);
+}
+
 int main(int argc, char **argv)
 {
     qemu_init_main_loop(&error_abort);
@@ -244,6 +280,9 @@ int main(int argc, char **argv)
     g_test_add_func("/thread-pool/submit-many", test_submit_many);
     g_test_add_func("/thread-pool/cancel", test_cancel);
     g_test_add_func("/thread-pool/cancel-async", test_cancel_async);
+    if (g_test_perf()) {
+        g_test_add_func("/thread-pool/perf/throughput", perf_throughput);
+    }
 
     return g_test_run();
 }
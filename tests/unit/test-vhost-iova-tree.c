@@ -0,0 +1,104 @@
+/*
+ * Test the vhost IOVA tree lookup cache
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "hw/virtio/vhost-iova-tree.h"
+
+/* Two maps that are adjacent in the translated address space */
+#define RAM_LOW_ADDR    0x100000
+#define RAM_LOW_SIZE    0x100000
+#define RAM_HIGH_ADDR   (RAM_LOW_ADDR + RAM_LOW_SIZE)
+#define RAM_HIGH_SIZE   0x10000
+
+static VhostIOVATree *tree;
+static DMAMap ram_low, ram_high;
+
+static void map_ram(DMAMap *map, hwaddr addr, hwaddr size)
+{
+    *map = (DMAMap) {
+        .translated_addr = addr,
+        .size = size - 1,
+        .perm = IOMMU_RW,
+    };
+    g_assert_cmpint(vhost_iova_tree_map_alloc(tree, map), ==, IOVA_OK);
+}
+
+static void setup(void)
+{
+    tree = vhost_iova_tree_new(0, UINT32_MAX);
+    map_ram(&ram_low, RAM_LOW_ADDR, RAM_LOW_SIZE);
+    map_ram(&ram_high, RAM_HIGH_ADDR, RAM_HIGH_SIZE);
+}
+
+/* Translated address of the map that holds [@addr, @addr + @size) */
+static hwaddr find(hwaddr addr, hwaddr size)
+{
+    const DMAMap needle = {
+        .translated_addr = addr,
+        .size = size - 1,
+    };
+    const DMAMap *map = vhost_iova_tree_find_iova(tree, &needle);
+
+    return map ? map->translated_addr : -1;
+}
+
+/* The cached map only answers for buffers that lie entirely inside it */
+static void test_cache_contains(void)
+{
+    setup();
+
+    g_assert_cmphex(find(RAM_LOW_ADDR + 0x1000, 0x100), ==, RAM_LOW_ADDR);
+
+    /* first and last byte, and the whole map */
+    g_assert_cmphex(find(RAM_LOW_ADDR, 1), ==, RAM_LOW_ADDR);
+    g_assert_cmphex(find(RAM_HIGH_ADDR - 1, 1), ==, RAM_LOW_ADDR);
+    g_assert_cmphex(find(RAM_LOW_ADDR, RAM_LOW_SIZE), ==, RAM_LOW_ADDR);
+
+    /* the neighbour of the cached map, starting at the boundary */
+    g_assert_cmphex(find(RAM_HIGH_ADDR, 1), ==, RAM_HIGH_ADDR);
+    g_assert_cmphex(find(RAM_HIGH_ADDR - 1, 1), ==, RAM_LOW_ADDR);
+    g_assert_cmphex(find(RAM_HIGH_ADDR, 0x100), ==, RAM_HIGH_ADDR);
+    g_assert_cmphex(find(RAM_LOW_ADDR + 0x2000, 0x100), ==, RAM_LOW_ADDR);
+
+    /* nothing is mapped around the two maps */
+    g_assert_cmphex(find(RAM_HIGH_ADDR + RAM_HIGH_SIZE, 0x100), ==, -1);
+    g_assert_cmphex(find(RAM_LOW_ADDR - 0x100, 0x100), ==, -1);
+
+    vhost_iova_tree_delete(tree);
+}
+
+/* Removing a map drops the cache, which would otherwise dangle */
+static void test_cache_remove(void)
+{
+    setup();
+
+    g_assert_cmphex(find(RAM_LOW_ADDR + 0x1000, 0x100), ==, RAM_LOW_ADDR);
+    vhost_iova_tree_remove(tree, ram_low);
+    g_assert_cmphex(find(RAM_LOW_ADDR + 0x1000, 0x100), ==, -1);
+    g_assert_cmphex(find(RAM_HIGH_ADDR, 0x100), ==, RAM_HIGH_ADDR);
+
+    /* a new map at the same address is found */
+    map_ram(&ram_low, RAM_LOW_ADDR, RAM_LOW_SIZE / 2);
+    g_assert_cmphex(find(RAM_LOW_ADDR + 0x1000, 0x100), ==, RAM_LOW_ADDR);
+
+    /* removing another map drops the cache too */
+    vhost_iova_tree_remove(tree, ram_high);
+    g_assert_cmphex(find(RAM_HIGH_ADDR, 0x100), ==, -1);
+    g_assert_cmphex(find(RAM_LOW_ADDR + 0x1000, 0x100), ==, RAM_LOW_ADDR);
+
+    vhost_iova_tree_delete(tree);
+}
+
+int main(int argc, char **argv)
+{
+    g_test_init(&argc, &argv, NULL);
+
+    g_test_add_func("/vhost/iova-tree/cache-contains", test_cache_contains);
+    g_test_add_func("/vhost/iova-tree/cache-remove", test_cache_remove);
+
+    return g_test_run();
+}
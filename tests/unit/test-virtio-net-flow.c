@@ -0,0 +1,183 @@
+/*
+ * Test the virtio-net RSS flow table
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+#include "hw/net/virtio-net-flow.h"
+
+#define GUEST_ADDR  0x0a000001
+#define PEER_ADDR   0x0a000002
+#define GUEST_PORT  40000
+#define PEER_PORT   80
+
+typedef struct TestPacket {
+    eth_ip4_hdr_info ip4;
+    eth_ip6_hdr_info ip6;
+    eth_l4_hdr_info l4;
+} TestPacket;
+
+/*
+ * Parsed headers of a packet of flow @n between the guest and its peer,
+ * sent by the guest if @tx is true and received by it otherwise.
+ */
+static void build_packet(TestPacket *p, bool ipv6, EthL4HdrProto proto,
+                         uint16_t n, bool tx)
+{
+    uint32_t src = tx ? GUEST_ADDR : PEER_ADDR;
+    uint32_t dst = tx ? PEER_ADDR : GUEST_ADDR;
+    uint16_t sport = tx ? GUEST_PORT + n : PEER_PORT;
+    uint16_t dport = tx ? PEER_PORT : GUEST_PORT + n;
+
+    memset(p, 0, sizeof(*p));
+    if (ipv6) {
+        stl_be_p(&p->ip6.ip6_hdr.ip6_src.__in6_u.__u6_addr8[12], src);
+        stl_be_p(&p->ip6.ip6_hdr.ip6_dst.__in6_u.__u6_addr8[12], dst);
+    } else {
+        p->ip4.ip4_hdr.ip_src = cpu_to_be32(src);
+        p->ip4.ip4_hdr.ip_dst = cpu_to_be32(dst);
+    }
+
+    p->l4.proto = proto;
+    if (proto == ETH_L4_HDR_PROTO_TCP) {
+        p->l4.hdr.tcp.th_sport = cpu_to_be16(sport);
+        p->l4.hdr.tcp.th_dport = cpu_to_be16(dport);
+    } else {
+        p->l4.hdr.udp.uh_sport = cpu_to_be16(sport);
+        p->l4.hdr.udp.uh_dport = cpu_to_be16(dport);
+    }
+}
+
+static void flow_key(bool ipv6, EthL4HdrProto proto, uint16_t n, bool tx,
+                     struct EBPFRSSFlowKey *key)
+{
+    TestPacket p;
+
+    build_packet(&p, ipv6, proto, n, tx);
+    g_assert(virtio_net_flow_key(!ipv6, ipv6, &p.ip4, &p.ip6, &p.l4, tx,
+                                 key));
+}
+
+/* Queue the table steers received packets of flow @n to, or -1 */
+static int rx_queue(VirtioNetFlowTable *table, bool ipv6,
+                    EthL4HdrProto proto, uint16_t n)
+{
+    struct EBPFRSSFlowKey key;
+    uint16_t queue;
+
+    flow_key(ipv6, proto, n, false, &key);
+    return virtio_net_flow_lookup(table, &key, &queue) ? queue : -1;
+}
+
+static bool tx_learn(VirtioNetFlowTable *table, bool ipv6,
+                     EthL4HdrProto proto, uint16_t n, uint16_t queue)
+{
+    struct EBPFRSSFlowKey key;
+
+    flow_key(ipv6, proto, n, true, &key);
+    return virtio_net_flow_learn(table, &key, queue);
+}
+
+/* A flow sent on a queue is received on it, also for IPv6 and UDP */
+static void test_learn(void)
+{
+    VirtioNetFlowTable *table = virtio_net_flow_table_new();
+
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 0), ==, -1);
+
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 2));
+    g_assert(tx_learn(table, true, ETH_L4_HDR_PROTO_TCP, 0, 3));
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_UDP, 0, 4));
+
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 0), ==, 2);
+    g_assert_cmpint(rx_queue(table, true, ETH_L4_HDR_PROTO_TCP, 0), ==, 3);
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_UDP, 0), ==, 4);
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 1), ==, -1);
+
+    /* Sending on the same queue again needs no eBPF map update */
+    g_assert(!tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 2));
+
+    virtio_net_flow_table_free(table);
+}
+
+static void test_move(void)
+{
+    VirtioNetFlowTable *table = virtio_net_flow_table_new();
+
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 1));
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 5));
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 0), ==, 5);
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 1));
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 0), ==, 1);
+
+    virtio_net_flow_table_free(table);
+}
+
+/* What virtio-net does when the guest reconfigures RSS */
+static void test_reset(void)
+{
+    VirtioNetFlowTable *table = virtio_net_flow_table_new();
+    uint16_t n;
+
+    for (n = 0; n < 16; n++) {
+        g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, n, n));
+    }
+    virtio_net_flow_table_reset(table);
+    for (n = 0; n < 16; n++) {
+        g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, n),
+                        ==, -1);
+    }
+
+    /* The table learns again after a reset */
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 3));
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 0), ==, 3);
+
+    virtio_net_flow_table_free(table);
+}
+
+/* Many more flows than entries: recently used flows stay in the table */
+static void test_evict(void)
+{
+    VirtioNetFlowTable *table = virtio_net_flow_table_new();
+    uint16_t n;
+
+    g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 7));
+    for (n = 1; n < 8192; n++) {
+        g_assert(tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, n, n % 8));
+        g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, n),
+                        ==, n % 8);
+        g_assert(!tx_learn(table, false, ETH_L4_HDR_PROTO_TCP, 0, 7));
+    }
+    g_assert_cmpint(rx_queue(table, false, ETH_L4_HDR_PROTO_TCP, 0), ==, 7);
+
+    virtio_net_flow_table_free(table);
+}
+
+static void test_no_key(void)
+{
+    struct EBPFRSSFlowKey key;
+    TestPacket p;
+
+    build_packet(&p, false, ETH_L4_HDR_PROTO_INVALID, 0, true);
+    g_assert(!virtio_net_flow_key(true, false, &p.ip4, &p.ip6, &p.l4, true,
+                                  &key));
+
+    build_packet(&p, false, ETH_L4_HDR_PROTO_TCP, 0, true);
+    g_assert(!virtio_net_flow_key(false, false, &p.ip4, &p.ip6, &p.l4, true,
+                                  &key));
+}
+
+int main(int argc, char **argv)
+{
+    g_test_init(&argc, &argv, NULL);
+
+    g_test_add_func("/virtio-net/flow/learn", test_learn);
+    g_test_add_func("/virtio-net/flow/move", test_move);
+    g_test_add_func("/virtio-net/flow/reset", test_reset);
+    g_test_add_func("/virtio-net/flow/evict", test_evict);
+    g_test_add_func("/virtio-net/flow/no-key", test_no_key);
+
+    return g_test_run();
+}
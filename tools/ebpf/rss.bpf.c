@@ -35,6 +35,8 @@
 
 #define INDIRECTION_TABLE_SIZE 128
 #define HASH_CALCULATION_BUFFER_SIZE 36
+#define FLOW_TABLE_SIZE 4096
+#define QUEUE_LOAD_TABLE_SIZE 256
 
 struct rss_config_t {
     __u8 redirect;
@@ -42,8 +44,21 @@ struct rss_config_t {
     __u32 hash_types;
     __u16 indirections_len;
     __u16 default_queue;
+    __u8 flow_steering;
+    __u8 load_balance;
+    __u16 queues;
 } __attribute__((packed));
 
+/* Receive direction 5-tuple, addresses and ports in network byte order */
+struct flow_key_t {
+    __u8 src[16];
+    __u8 dst[16];
+    __be16 src_port;
+    __be16 dst_port;
+    __u8 proto;
+    __u8 pad[3];
+};
+
 struct toeplitz_key_data_t {
     __u32 leftmost_32_bits;
     __u8 next_byte[HASH_CALCULATION_BUFFER_SIZE];
@@ -97,6 +112,25 @@ struct {
     __uint(max_entries, INDIRECTION_TABLE_SIZE);
 } tap_rss_map_indirection_table SEC(".maps");
 
+/*
+ * Queue of the guest vCPU that last transmitted on each flow,
+ * filled in by QEMU from the virtio-net TX path.
+ */
+struct {
+    __uint(type, BPF_MAP_TYPE_LRU_HASH);
+    __uint(key_size, sizeof(struct flow_key_t));
+    __uint(value_size, sizeof(__u16));
+    __uint(max_entries, FLOW_TABLE_SIZE);
+} tap_rss_map_flows SEC(".maps");
+
+/* Per-queue load reported by QEMU, zero means the queue keeps up */
+struct {
+    __uint(type, BPF_MAP_TYPE_ARRAY);
+    __uint(key_size, sizeof(__u32));
+    __uint(value_size, sizeof(__u32));
+    __uint(max_entries, QUEUE_LOAD_TABLE_SIZE);
+} tap_rss_map_queue_load SEC(".maps");
+
 static inline void net_rx_rss_add_chunk(__u8 *rss_input, size_t *bytes_written,
                                         const void *ptr, size_t size) {
     __builtin_memcpy(&rss_input[*bytes_written], ptr, size);
@@ -377,146 +411,198 @@ error:
     return err;
 }
 
-static inline __u32 calculate_rss_hash(struct __sk_buff *skb,
+static inline int flow_key_from_packet(struct packet_hash_info_t *info,
+                                       struct flow_key_t *key)
+{
+    if (info->is_tcp) {
+        key->proto = IPPROTO_TCP;
+    } else if (info->is_udp) {
+        key->proto = IPPROTO_UDP;
+    } else {
+        return -1;
+    }
+
+    if (info->is_ipv4) {
+        __builtin_memcpy(key->src, &info->in_src, sizeof(info->in_src));
+        __builtin_memcpy(key->dst, &info->in_dst, sizeof(info->in_dst));
+    } else if (info->is_ipv6) {
+        __builtin_memcpy(key->src, &info->in6_src, sizeof(info->in6_src));
+        __builtin_memcpy(key->dst, &info->in6_dst, sizeof(info->in6_dst));
+    } else {
+        return -1;
+    }
+
+    key->src_port = info->src_port;
+    key->dst_port = info->dst_port;
+
+    return 0;
+}
+
+/*
+ * If the queue picked by the indirection table is reported as loaded,
+ * try a second entry of the table chosen by other bits of the hash and
+ * keep whichever of the two queues is less loaded.
+ */
+static inline __u16 *balance_queue(struct rss_config_t *config, __u32 hash,
+                                   __u16 *queue)
+{
+    __u32 table_idx = (hash >> 16) % config->indirections_len;
+    __u32 queue_idx = *queue;
+    __u32 *load, *alt_load;
+    __u16 *alt;
+
+    load = bpf_map_lookup_elem(&tap_rss_map_queue_load, &queue_idx);
+    if (!load || !*load) {
+        return queue;
+    }
+
+    alt = bpf_map_lookup_elem(&tap_rss_map_indirection_table, &table_idx);
+    if (!alt) {
+        return queue;
+    }
+
+    queue_idx = *alt;
+    alt_load = bpf_map_lookup_elem(&tap_rss_map_queue_load, &queue_idx);
+    if (alt_load && *alt_load < *load) {
+        return alt;
+    }
+
+    return queue;
+}
+
+static inline __u32 calculate_rss_hash(struct packet_hash_info_t *info,
         struct rss_config_t *config, struct toeplitz_key_data_t *toe)
 {
     __u8 rss_input[HASH_CALCULATION_BUFFER_SIZE] = {};
     size_t bytes_written = 0;
     __u32 result = 0;
-    int err = 0;
-    struct packet_hash_info_t packet_info = {};
-
-    err = parse_packet(skb, &packet_info);
-    if (err) {
-        return 0;
-    }
 
-    if (packet_info.is_ipv4) {
-        if (packet_info.is_tcp &&
+    if (info->is_ipv4) {
+        if (info->is_tcp &&
             config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_TCPv4) {
 
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.in_src,
-                                 sizeof(packet_info.in_src));
+                                 &info->in_src,
+                                 sizeof(info->in_src));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.in_dst,
-                                 sizeof(packet_info.in_dst));
+                                 &info->in_dst,
+                                 sizeof(info->in_dst));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.src_port,
-                                 sizeof(packet_info.src_port));
+                                 &info->src_port,
+                                 sizeof(info->src_port));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.dst_port,
-                                 sizeof(packet_info.dst_port));
-        } else if (packet_info.is_udp &&
+                                 &info->dst_port,
+                                 sizeof(info->dst_port));
+        } else if (info->is_udp &&
                    config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_UDPv4) {
 
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.in_src,
-                                 sizeof(packet_info.in_src));
+                                 &info->in_src,
+                                 sizeof(info->in_src));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.in_dst,
-                                 sizeof(packet_info.in_dst));
+                                 &info->in_dst,
+                                 sizeof(info->in_dst));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.src_port,
-                                 sizeof(packet_info.src_port));
+                                 &info->src_port,
+                                 sizeof(info->src_port));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.dst_port,
-                                 sizeof(packet_info.dst_port));
+                                 &info->dst_port,
+                                 sizeof(info->dst_port));
         } else if (config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_IPv4) {
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.in_src,
-                                 sizeof(packet_info.in_src));
+                                 &info->in_src,
+                                 sizeof(info->in_src));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.in_dst,
-                                 sizeof(packet_info.in_dst));
+                                 &info->in_dst,
+                                 sizeof(info->in_dst));
         }
-    } else if (packet_info.is_ipv6) {
-        if (packet_info.is_tcp &&
+    } else if (info->is_ipv6) {
+        if (info->is_tcp &&
             config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_TCPv6) {
 
-            if (packet_info.is_ipv6_ext_src &&
+            if (info->is_ipv6_ext_src &&
                 config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_TCP_EX) {
 
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_ext_src,
-                                     sizeof(packet_info.in6_ext_src));
+                                     &info->in6_ext_src,
+                                     sizeof(info->in6_ext_src));
             } else {
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_src,
-                                     sizeof(packet_info.in6_src));
+                                     &info->in6_src,
+                                     sizeof(info->in6_src));
             }
-            if (packet_info.is_ipv6_ext_dst &&
+            if (info->is_ipv6_ext_dst &&
                 config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_TCP_EX) {
 
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_ext_dst,
-                                     sizeof(packet_info.in6_ext_dst));
+                                     &info->in6_ext_dst,
+                                     sizeof(info->in6_ext_dst));
             } else {
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_dst,
-                                     sizeof(packet_info.in6_dst));
+                                     &info->in6_dst,
+                                     sizeof(info->in6_dst));
             }
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.src_port,
-                                 sizeof(packet_info.src_port));
+                                 &info->src_port,
+                                 sizeof(info->src_port));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.dst_port,
-                                 sizeof(packet_info.dst_port));
-        } else if (packet_info.is_udp &&
+                                 &info->dst_port,
+                                 sizeof(info->dst_port));
+        } else if (info->is_udp &&
                    config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_UDPv6) {
 
-            if (packet_info.is_ipv6_ext_src &&
+            if (info->is_ipv6_ext_src &&
                config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_UDP_EX) {
 
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_ext_src,
-                                     sizeof(packet_info.in6_ext_src));
+                                     &info->in6_ext_src,
+                                     sizeof(info->in6_ext_src));
             } else {
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_src,
-                                     sizeof(packet_info.in6_src));
+                                     &info->in6_src,
+                                     sizeof(info->in6_src));
             }
-            if (packet_info.is_ipv6_ext_dst &&
+            if (info->is_ipv6_ext_dst &&
                config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_UDP_EX) {
 
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_ext_dst,
-                                     sizeof(packet_info.in6_ext_dst));
+                                     &info->in6_ext_dst,
+                                     sizeof(info->in6_ext_dst));
             } else {
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_dst,
-                                     sizeof(packet_info.in6_dst));
+                                     &info->in6_dst,
+                                     sizeof(info->in6_dst));
             }
 
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.src_port,
-                                 sizeof(packet_info.src_port));
+                                 &info->src_port,
+                                 sizeof(info->src_port));
             net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                 &packet_info.dst_port,
-                                 sizeof(packet_info.dst_port));
+                                 &info->dst_port,
+                                 sizeof(info->dst_port));
 
         } else if (config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_IPv6) {
-            if (packet_info.is_ipv6_ext_src &&
+            if (info->is_ipv6_ext_src &&
                config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_IP_EX) {
 
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_ext_src,
-                                     sizeof(packet_info.in6_ext_src));
+                                     &info->in6_ext_src,
+                                     sizeof(info->in6_ext_src));
             } else {
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_src,
-                                     sizeof(packet_info.in6_src));
+                                     &info->in6_src,
+                                     sizeof(info->in6_src));
             }
-            if (packet_info.is_ipv6_ext_dst &&
+            if (info->is_ipv6_ext_dst &&
                 config->hash_types & VIRTIO_NET_RSS_HASH_TYPE_IP_EX) {
 
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_ext_dst,
-                                     sizeof(packet_info.in6_ext_dst));
+                                     &info->in6_ext_dst,
+                                     sizeof(info->in6_ext_dst));
             } else {
                 net_rx_rss_add_chunk(rss_input, &bytes_written,
-                                     &packet_info.in6_dst,
-                                     sizeof(packet_info.in6_dst));
+                                     &info->in6_dst,
+                                     sizeof(info->in6_dst));
             }
         }
     }
@@ -534,9 +620,12 @@ int tun_rss_steering_prog(struct __sk_buff *skb)
 
     struct rss_config_t *config;
     struct toeplitz_key_data_t *toe;
+    struct packet_hash_info_t packet_info = {};
+    struct flow_key_t flow = {};
 
     __u32 key = 0;
     __u32 hash = 0;
+    __u16 *queue = 0;
 
     config = bpf_map_lookup_elem(&tap_rss_map_configurations, &key);
     toe = bpf_map_lookup_elem(&tap_rss_map_toeplitz_key, &key);
@@ -546,14 +635,30 @@ int tun_rss_steering_prog(struct __sk_buff *skb)
             return config->default_queue;
         }
 
-        hash = calculate_rss_hash(skb, config, toe);
+        if (parse_packet(skb, &packet_info)) {
+            return config->default_queue;
+        }
+
+        if (config->flow_steering &&
+            !flow_key_from_packet(&packet_info, &flow)) {
+            queue = bpf_map_lookup_elem(&tap_rss_map_flows, &flow);
+            /* the flow may have been learned with more queues active */
+            if (queue && *queue < config->queues) {
+                return *queue;
+            }
+        }
+
+        hash = calculate_rss_hash(&packet_info, config, toe);
         if (hash) {
             __u32 table_idx = hash % config->indirections_len;
-            __u16 *queue = 0;
 
             queue = bpf_map_lookup_elem(&tap_rss_map_indirection_table,
                                         &table_idx);
 
+            if (queue && config->load_balance) {
+                queue = balance_queue(config, hash, queue);
+            }
+
             if (queue) {
                 return *queue;
             }
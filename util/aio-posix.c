@@ -21,12 +21,25 @@
 #include "qemu/rcu_queue.h"
 #include "qemu/sockets.h"
 #include "qemu/cutils.h"
+#include "qemu/host-utils.h"
 #include "trace.h"
 #include "aio-posix.h"
 
 /* Stop userspace polling on a handler if it isn't active for some time */
 #define POLL_IDLE_INTERVAL_NS (7 * NANOSECONDS_PER_SECOND)
 
+/*
+ * Each handler's latency histogram is halved once it holds this many
+ * events, so that its polling time follows changes in the workload.
+ */
+#define POLL_HISTORY_EVENTS 256
+
+/*
+ * While polling keeps making progress, fds of handlers that are not polled
+ * are still checked once in this many aio_poll() calls.
+ */
+#define POLL_FD_CHECK_INTERVAL 16
+
 bool aio_poll_disabled(AioContext *ctx)
 {
     return qatomic_read(&ctx->poll_disable_cnt);
@@ -150,6 +163,7 @@ void aio_set_fd_handler(AioContext *ctx,
             new_node->pfd.fd = fd;
         } else {
             new_node->pfd = node->pfd;
+            new_node->poll = node->poll;
         }
         g_source_add_poll(&ctx->source, &new_node->pfd);
 
@@ -216,13 +230,28 @@ void aio_set_event_notifier_poll(AioContext *ctx,
                     (IOHandler *)io_poll_end);
 }
 
+/*
+ * Handlers whose events do not tend to arrive within the polling window are
+ * left to fd monitoring.  The notifier is always polled so that aio_notify()
+ * ends the polling loop.
+ */
+static bool node_is_polled(AioContext *ctx, AioHandler *node)
+{
+    return node->poll.ns || node->opaque == &ctx->notifier;
+}
+
+/*
+ * Start or stop polling @ctx.  While polling is started, this also brings the
+ * set of handlers that have notifications disabled via ->io_poll_begin() in
+ * line with node_is_polled().
+ */
 static bool poll_set_started(AioContext *ctx, AioHandlerList *ready_list,
                              bool started)
 {
     AioHandler *node;
     bool progress = false;
 
-    if (started == ctx->poll_started) {
+    if (!started && !ctx->poll_started) {
         return false;
     }
 
@@ -230,13 +259,19 @@ static bool poll_set_started(AioContext *ctx, AioHandlerList *ready_list,
 
     qemu_lockcnt_inc(&ctx->list_lock);
     QLIST_FOREACH(node, &ctx->poll_aio_handlers, node_poll) {
+        bool begin = started && node_is_polled(ctx, node);
         IOHandler *fn;
 
         if (QLIST_IS_INSERTED(node, node_deleted)) {
             continue;
         }
 
-        if (started) {
+        if (begin == node->poll_begun) {
+            continue;
+        }
+
+        node->poll_begun = begin;
+        if (begin) {
             fn = node->io_poll_begin;
         } else {
             fn = node->io_poll_end;
@@ -247,7 +282,7 @@ static bool poll_set_started(AioContext *ctx, AioHandlerList *ready_list,
         }
 
         /* Poll one last time in case ->io_poll_end() raced with the event */
-        if (!started && node->io_poll(node->opaque)) {
+        if (!begin && node->io_poll(node->opaque)) {
             aio_add_poll_ready_handler(ready_list, node);
             progress = true;
         }
@@ -344,8 +379,11 @@ static bool aio_dispatch_handler(AioContext *ctx, AioHandler *node)
         !QLIST_IS_INSERTED(node, node_poll) &&
         node->io_poll) {
         trace_poll_add(ctx, node, node->pfd.fd, revents);
-        if (ctx->poll_started && node->io_poll_begin) {
-            node->io_poll_begin(node->opaque);
+        if (ctx->poll_started && node_is_polled(ctx, node)) {
+            node->poll_begun = true;
+            if (node->io_poll_begin) {
+                node->io_poll_begin(node->opaque);
+            }
         }
         QLIST_INSERT_HEAD(&ctx->poll_aio_handlers, node, node_poll);
     }
@@ -426,6 +464,93 @@ void aio_dispatch(AioContext *ctx)
     timerlistgroup_run_timers(&ctx->tlg);
 }
 
+static unsigned poll_latency_bucket(int64_t ns)
+{
+    if (ns <= 0) {
+        return 0;
+    }
+    return MIN(64 - clz64(ns), AIO_POLL_LATENCY_BUCKETS - 1);
+}
+
+/*
+ * Return how long the handler should be polled for: long enough to catch
+ * three quarters of its recent events, or 0 if that takes longer than the
+ * maximum polling time.
+ */
+static int64_t poll_target_ns(AioContext *ctx, AioPolledEvent *poll)
+{
+    unsigned int want = DIV_ROUND_UP(poll->events * 3, 4);
+    unsigned int sum = 0;
+    unsigned i;
+
+    for (i = 0; i < AIO_POLL_LATENCY_BUCKETS - 1; i++) {
+        sum += poll->latency[i];
+        if (sum >= want) {
+            break;
+        }
+    }
+
+    if (i == 0 || (1LL << (i - 1)) >= ctx->poll_max_ns) {
+        return 0;
+    }
+    return MIN(1LL << i, ctx->poll_max_ns);
+}
+
+/*
+ * Record an event of @node that arrived @block_ns after the start of
+ * aio_poll(), and move its polling time towards the target derived from its
+ * latency histogram at the rate given by the poll-grow and poll-shrink
+ * parameters.  A @block_ns of INT64_MAX records that no event arrived.
+ */
+static void adjust_polling_time(AioContext *ctx, AioHandler *node,
+                                int64_t block_ns)
+{
+    AioPolledEvent *poll = &node->poll;
+    unsigned bucket = poll_latency_bucket(block_ns);
+    int64_t old = poll->ns;
+    int64_t target;
+    unsigned i;
+
+    if (poll->events >= POLL_HISTORY_EVENTS) {
+        poll->events = 0;
+        for (i = 0; i < AIO_POLL_LATENCY_BUCKETS; i++) {
+            poll->latency[i] /= 2;
+            poll->events += poll->latency[i];
+        }
+    }
+    poll->latency[bucket]++;
+    poll->events++;
+
+    target = poll_target_ns(ctx, poll);
+    if (poll->ns < target) {
+        /* Events arrive soon enough to be worth polling for, poll longer */
+        int64_t grow = ctx->poll_grow;
+
+        if (grow == 0) {
+            grow = 2;
+        }
+
+        if (poll->ns) {
+            poll->ns *= grow;
+        } else {
+            poll->ns = 4000; /* start polling at 4 microseconds */
+        }
+        poll->ns = MIN(poll->ns, target);
+
+        trace_poll_grow(ctx, node, old, poll->ns);
+    } else if (poll->ns > target) {
+        /* We'd poll for longer than events usually take, poll less */
+        if (ctx->poll_shrink) {
+            poll->ns /= ctx->poll_shrink;
+        } else {
+            poll->ns = 0;
+        }
+        poll->ns = MAX(poll->ns, target);
+
+        trace_poll_shrink(ctx, node, old, poll->ns);
+    }
+}
+
 static bool run_poll_handlers_once(AioContext *ctx,
                                    AioHandlerList *ready_list,
                                    int64_t now,
@@ -436,7 +561,8 @@ static bool run_poll_handlers_once(AioContext *ctx,
     AioHandler *tmp;
 
     QLIST_FOREACH_SAFE(node, &ctx->poll_aio_handlers, node_poll, tmp) {
-        if (aio_node_check(ctx, node->is_external) &&
+        if (node->poll_begun &&
+            aio_node_check(ctx, node->is_external) &&
             node->io_poll(node->opaque)) {
             aio_add_poll_ready_handler(ready_list, node);
 
@@ -488,8 +614,11 @@ static bool remove_idle_poll_handlers(AioContext *ctx,
             trace_poll_remove(ctx, node, node->pfd.fd);
             node->poll_idle_timeout = 0LL;
             QLIST_SAFE_REMOVE(node, node_poll);
-            if (ctx->poll_started && node->io_poll_end) {
-                node->io_poll_end(node->opaque);
+            if (node->poll_begun) {
+                node->poll_begun = false;
+                if (node->io_poll_end) {
+                    node->io_poll_end(node->opaque);
+                }
 
                 /*
                  * Final poll in case ->io_poll_end() races with an event.
@@ -577,19 +706,35 @@ static bool run_poll_handlers(AioContext *ctx, AioHandlerList *ready_list,
 static bool try_poll_mode(AioContext *ctx, AioHandlerList *ready_list,
                           int64_t *timeout)
 {
+    AioHandler *node;
     int64_t max_ns;
 
+    ctx->poll_unpolled = false;
     if (QLIST_EMPTY_RCU(&ctx->poll_aio_handlers)) {
         return false;
     }
 
+    /* Poll for long enough to catch the events of the slowest handler */
+    ctx->poll_ns = 0;
+    QLIST_FOREACH(node, &ctx->poll_aio_handlers, node_poll) {
+        ctx->poll_ns = MAX(ctx->poll_ns, node->poll.ns);
+        if (!node_is_polled(ctx, node)) {
+            ctx->poll_unpolled = true;
+        }
+    }
+    ctx->poll_ns = MIN(ctx->poll_ns, ctx->poll_max_ns);
+
     max_ns = qemu_soonest_timeout(*timeout, ctx->poll_ns);
     if (max_ns && !ctx->fdmon_ops->need_wait(ctx)) {
         /*
-         * Enable poll mode. It pairs with the poll_set_started() in
+         * Enable poll mode, or update the set of polled handlers if it is
+         * already enabled. It pairs with the poll_set_started() in
          * aio_poll() which disables poll mode.
          */
-        poll_set_started(ctx, ready_list, true);
+        if (poll_set_started(ctx, ready_list, true)) {
+            *timeout = 0;
+            return true;
+        }
 
         if (run_poll_handlers(ctx, ready_list, max_ns, timeout)) {
             return true;
@@ -667,6 +812,15 @@ bool aio_poll(AioContext *ctx, bool blocking)
         }
 
         ctx->fdmon_ops->wait(ctx, &ready_list, timeout);
+        ctx->poll_fd_skipped = 0;
+    } else if (ctx->poll_unpolled &&
+               ++ctx->poll_fd_skipped >= POLL_FD_CHECK_INTERVAL) {
+        /*
+         * Handlers that are not polled rely on fd monitoring.  Don't let
+         * them starve while the polled ones keep making progress.
+         */
+        ctx->fdmon_ops->wait(ctx, &ready_list, 0);
+        ctx->poll_fd_skipped = 0;
     }
 
     if (use_notify_me) {
@@ -680,46 +834,37 @@ bool aio_poll(AioContext *ctx, bool blocking)
     /* Adjust polling time */
     if (ctx->poll_max_ns) {
         int64_t block_ns = qemu_clock_get_ns(QEMU_CLOCK_REALTIME) - start;
-
-        if (block_ns <= ctx->poll_ns) {
-            /* This is the sweet spot, no adjustment needed */
-        } else if (block_ns > ctx->poll_max_ns) {
-            /* We'd have to poll for too long, poll less */
-            int64_t old = ctx->poll_ns;
-
-            if (ctx->poll_shrink) {
-                ctx->poll_ns /= ctx->poll_shrink;
-            } else {
-                ctx->poll_ns = 0;
-            }
-
-            trace_poll_shrink(ctx, old, ctx->poll_ns);
-        } else if (ctx->poll_ns < ctx->poll_max_ns &&
-                   block_ns < ctx->poll_max_ns) {
-            /* There is room to grow, poll longer */
-            int64_t old = ctx->poll_ns;
-            int64_t grow = ctx->poll_grow;
-
-            if (grow == 0) {
-                grow = 2;
-            }
-
-            if (ctx->poll_ns) {
-                ctx->poll_ns *= grow;
-            } else {
-                ctx->poll_ns = 4000; /* start polling at 4 microseconds */
+        unsigned bucket = poll_latency_bucket(block_ns);
+        AioHandler *node;
+
+        QLIST_FOREACH(node, &ready_list, node_ready) {
+            if (node->io_poll && node->opaque != &ctx->notifier) {
+                stat64_add(node->poll_ready ? &ctx->poll_stats.poll_hits
+                                            : &ctx->poll_stats.fd_events, 1);
+                stat64_add(&ctx->poll_stats.latency[bucket], 1);
+                adjust_polling_time(ctx, node, block_ns);
             }
+        }
 
-            if (ctx->poll_ns > ctx->poll_max_ns) {
-                ctx->poll_ns = ctx->poll_max_ns;
+        /*
+         * A handler that had no event although its whole polling time went
+         * by was polled in vain.  Count that as a miss so that the polling
+         * time of idle handlers shrinks, instead of keeping ctx->poll_ns up
+         * until remove_idle_poll_handlers() drops them.
+         */
+        QLIST_FOREACH(node, &ctx->poll_aio_handlers, node_poll) {
+            if (node->poll.ns && block_ns >= node->poll.ns &&
+                !QLIST_IS_INSERTED(node, node_ready)) {
+                adjust_polling_time(ctx, node, INT64_MAX);
             }
-
-            trace_poll_grow(ctx, old, ctx->poll_ns);
         }
     }
 
     progress |= aio_bh_poll(ctx);
     progress |= aio_dispatch_ready_handlers(ctx, &ready_list);
+    if (ctx->fdmon_ops->dispatch) {
+        progress |= ctx->fdmon_ops->dispatch(ctx);
+    }
 
     aio_free_deleted_handlers(ctx);
 
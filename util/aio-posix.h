@@ -19,6 +19,14 @@
 
 #include "block/aio.h"
 
+/* Per-handler userspace polling state */
+typedef struct {
+    int64_t ns;             /* current polling time in nanoseconds */
+    unsigned int events;    /* sum of latency[] */
+    /* recent event latencies, in the buckets used by AioPollStats */
+    uint16_t latency[AIO_POLL_LATENCY_BUCKETS];
+} AioPolledEvent;
+
 struct AioHandler {
     GPollFD pfd;
     IOHandler *io_read;
@@ -36,8 +44,10 @@ struct AioHandler {
     QSLIST_ENTRY(AioHandler) node_submitted;
     unsigned flags; /* see fdmon-io_uring.c */
 #endif
+    AioPolledEvent poll;
     int64_t poll_idle_timeout; /* when to stop userspace polling */
     bool poll_ready; /* has polling detected an event? */
+    bool poll_begun; /* polled, with ->io_poll_begin() called? */
     bool is_external;
 };
 
@@ -19,13 +19,20 @@
  * 4. Nanosecond timeouts are supported so it requires fewer syscalls than
  *    epoll(7).
  *
- * This code only monitors file descriptors and does not do asynchronous disk
- * I/O.  Implementing disk I/O efficiently has other requirements and should
- * use a separate io_uring so it does not make sense to unify the code.
+ * Other code running in the AioContext's home thread can add its own requests
+ * to the ring with aio_add_sqe(), for example block/io_uring.c for disk I/O.
+ * They are submitted and completed by the same io_uring_enter(2) system call
+ * that waits for file descriptor events.
  *
  * File descriptor monitoring is implemented using the following operations:
  *
- * 1. IORING_OP_POLL_ADD - adds a file descriptor to be monitored.
+ * 1. IORING_OP_POLL_ADD - adds a file descriptor to be monitored.  Multishot
+ *    polls (IORING_POLL_ADD_MULTI) stay armed and post a cqe for each event,
+ *    so they only need to be re-armed if the kernel terminates them.  They are
+ *    level-triggered (IORING_POLL_ADD_LEVEL) because handlers do not always
+ *    consume everything that is ready.  Kernels without support for this fail
+ *    the first one with -EINVAL, after which one-shot polls are used and
+ *    re-armed after every event.
  * 2. IORING_OP_POLL_REMOVE - removes a file descriptor being monitored.  When
  *    the poll mask changes for a file descriptor it is first removed and then
  *    re-added with the new poll mask, so this operation is also used as part
@@ -34,11 +41,16 @@
  *    for events.  This operation self-cancels if another event completes
  *    before the timeout.
  *
+ * While external clients are disabled, events of external handlers are held
+ * back on ctx->fdmon_io_uring_deferred and dispatched once they are enabled
+ * again, so the ring stays in use throughout.
+ *
  * io_uring calls the submission queue the "sq ring" and the completion queue
  * the "cq ring".  Ring entries are called "sqe" and "cqe", respectively.
  *
  * The code is structured so that sq/cq rings are only modified within
- * fdmon_io_uring_wait().  Changes to AioHandlers are made by enqueuing them on
+ * fdmon_io_uring_wait() and aio_add_sqe(), both of which run in the
+ * AioContext's home thread.  Changes to AioHandlers are made by enqueuing them on
  * ctx->submit_list so that fdmon_io_uring_wait() can submit IORING_OP_POLL_ADD
  * and/or IORING_OP_POLL_REMOVE sqes for them.
  */
@@ -46,6 +58,7 @@
 #include "qemu/osdep.h"
 #include <poll.h>
 #include "qemu/rcu_queue.h"
+#include "block/aio-wait.h"
 #include "aio-posix.h"
 
 enum {
@@ -57,6 +70,12 @@ enum {
     FDMON_IO_URING_REMOVE   = (1 << 2),
 };
 
+/*
+ * The user_data of aio_add_sqe() requests is a CqeHandler pointer with this
+ * bit set, to tell them apart from AioHandler pointers.
+ */
+#define CQE_HANDLER_TAG 1
+
 static inline int poll_events_from_pfd(int pfd_events)
 {
     return (pfd_events & G_IO_IN ? POLLIN : 0) |
@@ -74,8 +93,8 @@ static inline int pfd_events_from_poll(int poll_events)
 }
 
 /*
- * Returns an sqe for submitting a request.  Only be called within
- * fdmon_io_uring_wait().
+ * Returns an sqe for submitting a request.  Only called in the AioContext's
+ * home thread, within fdmon_io_uring_wait() or aio_add_sqe().
  */
 static struct io_uring_sqe *get_sqe(AioContext *ctx)
 {
@@ -172,6 +191,11 @@ static void add_poll_add_sqe(AioContext *ctx, AioHandler *node)
     int events = poll_events_from_pfd(node->pfd.events);
 
     io_uring_prep_poll_add(sqe, node->pfd.fd, events);
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_POLL_ADD_LEVEL)
+    if (ctx->fdmon_io_uring_multishot) {
+        sqe->len |= IORING_POLL_ADD_MULTI | IORING_POLL_ADD_LEVEL;
+    }
+#endif
     io_uring_sqe_set_data(sqe, node);
 }
 
@@ -186,17 +210,15 @@ static void add_poll_remove_sqe(AioContext *ctx, AioHandler *node)
 #endif
 }
 
-/* Add a timeout that self-cancels when another cqe becomes ready */
-static void add_timeout_sqe(AioContext *ctx, int64_t ns)
+/*
+ * Add a timeout that self-cancels when another cqe becomes ready.  The kernel
+ * only reads @ts when the sqe is submitted, so it must stay valid until then.
+ */
+static void add_timeout_sqe(AioContext *ctx, struct __kernel_timespec *ts)
 {
-    struct io_uring_sqe *sqe;
-    struct __kernel_timespec ts = {
-        .tv_sec = ns / NANOSECONDS_PER_SECOND,
-        .tv_nsec = ns % NANOSECONDS_PER_SECOND,
-    };
-
-    sqe = get_sqe(ctx);
-    io_uring_prep_timeout(sqe, &ts, 1, 0);
+    struct io_uring_sqe *sqe = get_sqe(ctx);
+
+    io_uring_prep_timeout(sqe, ts, 1, 0);
 }
 
 /* Add sqes from ctx->submit_list for submission */
@@ -224,32 +246,96 @@ static bool process_cqe(AioContext *ctx,
                         AioHandlerList *ready_list,
                         struct io_uring_cqe *cqe)
 {
-    AioHandler *node = io_uring_cqe_get_data(cqe);
+    uintptr_t data = (uintptr_t)io_uring_cqe_get_data(cqe);
+    AioHandler *node;
     unsigned flags;
+    int revents;
+    bool more = false;
 
     /* poll_timeout and poll_remove have a zero user_data field */
-    if (!node) {
+    if (!data) {
         return false;
     }
 
-    /*
-     * Deletion can only happen when IORING_OP_POLL_ADD completes.  If we race
-     * with enqueue() here then we can safely clear the FDMON_IO_URING_REMOVE
-     * bit before IORING_OP_POLL_REMOVE is submitted.
-     */
-    flags = qatomic_fetch_and(&node->flags, ~FDMON_IO_URING_REMOVE);
-    if (flags & FDMON_IO_URING_REMOVE) {
-        QLIST_INSERT_HEAD_RCU(&ctx->deleted_aio_handlers, node, node_deleted);
+    if (data & CQE_HANDLER_TAG) {
+        CqeHandler *cqe_handler = (CqeHandler *)(data & ~CQE_HANDLER_TAG);
+
+        /* Callbacks may run a nested aio_poll(), so run them later */
+        cqe_handler->cqe = *cqe;
+        QLIST_REMOVE(cqe_handler, node_inflight);
+        QSIMPLEQ_INSERT_TAIL(&ctx->cqe_handler_ready_list, cqe_handler, next);
         return false;
     }
 
-    aio_add_ready_handler(ready_list, node, pfd_events_from_poll(cqe->res));
+    node = (AioHandler *)data;
+#ifdef IORING_CQE_F_MORE
+    more = cqe->flags & IORING_CQE_F_MORE;
+#endif
 
-    /* IORING_OP_POLL_ADD is one-shot so we must re-arm it */
-    add_poll_add_sqe(ctx, node);
+    if (more) {
+        /* The poll is still armed, ignore events of handlers being removed */
+        if (qatomic_read(&node->flags) & FDMON_IO_URING_REMOVE) {
+            return false;
+        }
+    } else {
+        /*
+         * Deletion can only happen when IORING_OP_POLL_ADD completes.  If we
+         * race with enqueue() here then we can safely clear the
+         * FDMON_IO_URING_REMOVE bit before IORING_OP_POLL_REMOVE is
+         * submitted.
+         */
+        flags = qatomic_fetch_and(&node->flags, ~FDMON_IO_URING_REMOVE);
+        if (flags & FDMON_IO_URING_REMOVE) {
+            QLIST_SAFE_REMOVE(node, node_ready); /* may have been deferred */
+            QLIST_INSERT_HEAD_RCU(&ctx->deleted_aio_handlers, node,
+                                  node_deleted);
+            return false;
+        }
+
+        if (cqe->res == -EINVAL && ctx->fdmon_io_uring_multishot) {
+            /* The kernel does not support multishot polls */
+            ctx->fdmon_io_uring_multishot = false;
+        }
+
+        /* The poll has terminated, re-arm it */
+        add_poll_add_sqe(ctx, node);
+    }
+
+    if (cqe->res < 0) {
+        return false;
+    }
+
+    revents = pfd_events_from_poll(cqe->res);
+
+    if (node->is_external && qatomic_read(&ctx->external_disable_cnt)) {
+        /* Hold the event back until external clients are enabled again */
+        QLIST_SAFE_REMOVE(node, node_ready);
+        node->pfd.revents |= revents;
+        QLIST_INSERT_HEAD(&ctx->fdmon_io_uring_deferred, node, node_ready);
+        return false;
+    }
+
+    aio_add_ready_handler(ready_list, node, revents);
     return true;
 }
 
+/* Move events held back while external clients were disabled */
+static int process_deferred(AioContext *ctx, AioHandlerList *ready_list)
+{
+    AioHandler *node;
+    int num_ready = 0;
+
+    if (qatomic_read(&ctx->external_disable_cnt)) {
+        return 0;
+    }
+
+    while ((node = QLIST_FIRST(&ctx->fdmon_io_uring_deferred))) {
+        aio_add_ready_handler(ready_list, node, node->pfd.revents);
+        num_ready++;
+    }
+    return num_ready;
+}
+
 static int process_cq_ring(AioContext *ctx, AioHandlerList *ready_list)
 {
     struct io_uring *ring = &ctx->fdmon_io_uring;
@@ -273,18 +359,20 @@ static int process_cq_ring(AioContext *ctx, AioHandlerList *ready_list)
 static int fdmon_io_uring_wait(AioContext *ctx, AioHandlerList *ready_list,
                                int64_t timeout)
 {
+    struct __kernel_timespec ts;
     unsigned wait_nr = 1; /* block until at least one cqe is ready */
+    int num_ready;
     int ret;
 
-    /* Fall back while external clients are disabled */
-    if (qatomic_read(&ctx->external_disable_cnt)) {
-        return fdmon_poll_ops.wait(ctx, ready_list, timeout);
-    }
+    num_ready = process_deferred(ctx, ready_list);
 
-    if (timeout == 0) {
+    if (timeout == 0 || num_ready ||
+        !QSIMPLEQ_EMPTY(&ctx->cqe_handler_ready_list)) {
         wait_nr = 0; /* non-blocking */
     } else if (timeout > 0) {
-        add_timeout_sqe(ctx, timeout);
+        ts.tv_sec = timeout / NANOSECONDS_PER_SECOND;
+        ts.tv_nsec = timeout % NANOSECONDS_PER_SECOND;
+        add_timeout_sqe(ctx, &ts);
     }
 
     fill_sq_ring(ctx);
@@ -295,7 +383,7 @@ static int fdmon_io_uring_wait(AioContext *ctx, AioHandlerList *ready_list,
 
     assert(ret >= 0);
 
-    return process_cq_ring(ctx, ready_list);
+    return num_ready + process_cq_ring(ctx, ready_list);
 }
 
 static bool fdmon_io_uring_need_wait(AioContext *ctx)
@@ -315,16 +403,53 @@ static bool fdmon_io_uring_need_wait(AioContext *ctx)
         return true;
     }
 
-    /* Are we falling back to fdmon-poll? */
-    return qatomic_read(&ctx->external_disable_cnt);
+    /* Are there held back events that can be dispatched now? */
+    return !QLIST_EMPTY(&ctx->fdmon_io_uring_deferred) &&
+           !qatomic_read(&ctx->external_disable_cnt);
+}
+
+static bool fdmon_io_uring_dispatch(AioContext *ctx)
+{
+    CqeHandler *cqe_handler;
+    bool progress = false;
+
+    /* Dequeue before calling, the callback may run a nested aio_poll() */
+    while ((cqe_handler = QSIMPLEQ_FIRST(&ctx->cqe_handler_ready_list))) {
+        QSIMPLEQ_REMOVE_HEAD(&ctx->cqe_handler_ready_list, next);
+        cqe_handler->cb(cqe_handler);
+        progress = true;
+    }
+    return progress;
 }
 
 static const FDMonOps fdmon_io_uring_ops = {
     .update = fdmon_io_uring_update,
     .wait = fdmon_io_uring_wait,
     .need_wait = fdmon_io_uring_need_wait,
+    .dispatch = fdmon_io_uring_dispatch,
 };
 
+bool aio_has_io_uring(AioContext *ctx)
+{
+    return ctx->fdmon_ops == &fdmon_io_uring_ops;
+}
+
+void aio_add_sqe(AioContext *ctx,
+                 void (*prep_sqe)(struct io_uring_sqe *sqe, void *opaque),
+                 void *opaque, CqeHandler *cqe_handler)
+{
+    struct io_uring_sqe *sqe = get_sqe(ctx);
+
+    assert(aio_has_io_uring(ctx));
+    assert(in_aio_context_home_thread(ctx));
+
+    prep_sqe(sqe, opaque);
+    io_uring_sqe_set_data(sqe, (void *)((uintptr_t)cqe_handler |
+                                        CQE_HANDLER_TAG));
+    QLIST_INSERT_HEAD(&ctx->cqe_handler_inflight_list, cqe_handler,
+                      node_inflight);
+}
+
 bool fdmon_io_uring_setup(AioContext *ctx)
 {
     int ret;
@@ -335,15 +460,81 @@ bool fdmon_io_uring_setup(AioContext *ctx)
     }
 
     QSLIST_INIT(&ctx->submit_list);
+    QLIST_INIT(&ctx->fdmon_io_uring_deferred);
+    QLIST_INIT(&ctx->cqe_handler_inflight_list);
+    QSIMPLEQ_INIT(&ctx->cqe_handler_ready_list);
+#if defined(IORING_POLL_ADD_MULTI) && defined(IORING_POLL_ADD_LEVEL)
+    ctx->fdmon_io_uring_multishot = true;
+#endif
     ctx->fdmon_ops = &fdmon_io_uring_ops;
     return true;
 }
 
+/*
+ * Cancel the aio_add_sqe() requests that are still in flight and wait until
+ * the kernel is done with all of them, since they may refer to memory that
+ * their owners free on completion.  Requests that could not be cancelled
+ * complete normally.
+ */
+static void cancel_inflight_cqe_handlers(AioContext *ctx)
+{
+    struct io_uring *ring = &ctx->fdmon_io_uring;
+    struct io_uring_cqe *cqe;
+    CqeHandler *cqe_handler;
+    int ret;
+
+    QLIST_FOREACH(cqe_handler, &ctx->cqe_handler_inflight_list,
+                  node_inflight) {
+        struct io_uring_sqe *sqe = get_sqe(ctx);
+
+        io_uring_prep_cancel(sqe, (void *)((uintptr_t)cqe_handler |
+                                           CQE_HANDLER_TAG), 0);
+        io_uring_sqe_set_data(sqe, NULL);
+    }
+
+    do {
+        ret = io_uring_submit(ring);
+    } while (ret == -EINTR);
+
+    while (ret >= 0 && !QLIST_EMPTY(&ctx->cqe_handler_inflight_list)) {
+        uintptr_t data;
+
+        ret = io_uring_wait_cqe(ring, &cqe);
+        if (ret == -EINTR) {
+            ret = 0;
+            continue;
+        }
+        if (ret < 0) {
+            break;
+        }
+
+        /* Events of AioHandlers are reported again by the next fdmon */
+        data = (uintptr_t)io_uring_cqe_get_data(cqe);
+        if (data & CQE_HANDLER_TAG) {
+            cqe_handler = (CqeHandler *)(data & ~CQE_HANDLER_TAG);
+            cqe_handler->cqe = *cqe;
+            QLIST_REMOVE(cqe_handler, node_inflight);
+            QSIMPLEQ_INSERT_TAIL(&ctx->cqe_handler_ready_list, cqe_handler,
+                                 next);
+        }
+        io_uring_cqe_seen(ring, cqe);
+    }
+
+    /* Only reached if io_uring_enter(2) failed */
+    while ((cqe_handler = QLIST_FIRST(&ctx->cqe_handler_inflight_list))) {
+        QLIST_REMOVE(cqe_handler, node_inflight);
+        memset(&cqe_handler->cqe, 0, sizeof(cqe_handler->cqe));
+        cqe_handler->cqe.res = -ECANCELED;
+        QSIMPLEQ_INSERT_TAIL(&ctx->cqe_handler_ready_list, cqe_handler, next);
+    }
+}
+
 void fdmon_io_uring_destroy(AioContext *ctx)
 {
     if (ctx->fdmon_ops == &fdmon_io_uring_ops) {
         AioHandler *node;
 
+        cancel_inflight_cqe_handlers(ctx);
         io_uring_queue_exit(&ctx->fdmon_io_uring);
 
         /* Move handlers due to be removed onto the deleted list */
@@ -360,6 +551,21 @@ void fdmon_io_uring_destroy(AioContext *ctx)
             QSLIST_REMOVE_HEAD_RCU(&ctx->submit_list, node_submitted);
         }
 
+        /*
+         * Held back events are dropped; the fds are still ready, so the next
+         * fd monitoring implementation reports them again.
+         */
+        while ((node = QLIST_FIRST(&ctx->fdmon_io_uring_deferred))) {
+            node->pfd.revents = 0;
+            QLIST_SAFE_REMOVE(node, node_ready);
+        }
+
         ctx->fdmon_ops = &fdmon_poll_ops;
+
+        /*
+         * Complete the aio_add_sqe() requests.  The callbacks see that @ctx
+         * no longer uses io_uring, so anything they resubmit goes elsewhere.
+         */
+        fdmon_io_uring_dispatch(ctx);
     }
 }
@@ -16,6 +16,7 @@
 #include "trace.h"
 #include "qemu/thread.h"
 #include "qemu/atomic.h"
+#include "qemu/stats64.h"
 #include "qemu/coroutine_int.h"
 #include "qemu/coroutine-tls.h"
 #include "block/aio.h"
@@ -25,10 +26,20 @@
  * reused as soon as there are 64 coroutines in it. The maximum pool size starts
  * with 64 and is increased on demand so that coroutines are not deleted even if
  * they are not immediately reused.
+ *
+ * Each thread keeps terminated coroutines in its own alloc_pool first and
+ * only hands them to the release_pool when that is full.  A thread's pool
+ * may grow beyond the maximum by one coroutine for each pool miss in that
+ * thread, up to POOL_MAX_THREAD_GROWTH, so that it follows the number of
+ * requests that the thread has in flight.  Every POOL_DECAY_INTERVAL
+ * creations, half of the coroutines that stayed in the pool for the whole
+ * interval are given up, so that the pool also follows a shrinking load.
  */
 enum {
     POOL_MIN_BATCH_SIZE = 64,
     POOL_INITIAL_MAX_SIZE = 64,
+    POOL_MAX_THREAD_GROWTH = 1024,
+    POOL_DECAY_INTERVAL = 1024,
 };
 
 /** Free list to speed up creation */
@@ -36,21 +47,109 @@ static QSLIST_HEAD(, Coroutine) release_pool = QSLIST_HEAD_INITIALIZER(pool);
 static unsigned int pool_max_size = POOL_INITIAL_MAX_SIZE;
 static unsigned int release_pool_size;
 
+static Stat64 pool_hits;
+static Stat64 pool_misses;
+
 typedef QSLIST_HEAD(, Coroutine) CoroutineQSList;
-QEMU_DEFINE_STATIC_CO_TLS(CoroutineQSList, alloc_pool);
-QEMU_DEFINE_STATIC_CO_TLS(unsigned int, alloc_pool_size);
+
+typedef struct {
+    CoroutineQSList alloc_pool;
+    unsigned int alloc_pool_size;
+    unsigned int growth;
+
+    /* Smallest alloc_pool_size and number of creations in this interval */
+    unsigned int low_water;
+    unsigned int creations;
+
+    /* Added to pool_hits in batches to keep the fast path thread-local */
+    unsigned int hits;
+} CoroutineThreadPool;
+
+QEMU_DEFINE_STATIC_CO_TLS(CoroutineThreadPool, thread_pool);
 QEMU_DEFINE_STATIC_CO_TLS(Notifier, coroutine_pool_cleanup_notifier);
 
 static void coroutine_pool_cleanup(Notifier *n, void *value)
 {
     Coroutine *co;
     Coroutine *tmp;
-    CoroutineQSList *alloc_pool = get_ptr_alloc_pool();
+    CoroutineThreadPool *tp = get_ptr_thread_pool();
+
+    QSLIST_FOREACH_SAFE(co, &tp->alloc_pool, pool_next, tmp) {
+        QSLIST_REMOVE_HEAD(&tp->alloc_pool, pool_next);
+        qemu_coroutine_delete(co);
+    }
+    tp->alloc_pool_size = 0;
+    stat64_add(&pool_hits, tp->hits);
+    tp->hits = 0;
+}
+
+static void coroutine_pool_register_cleanup(void)
+{
+    Notifier *notifier = get_ptr_coroutine_pool_cleanup_notifier();
+
+    if (!notifier->notify) {
+        notifier->notify = coroutine_pool_cleanup;
+        qemu_thread_atexit_add(notifier);
+    }
+}
 
-    QSLIST_FOREACH_SAFE(co, alloc_pool, pool_next, tmp) {
-        QSLIST_REMOVE_HEAD(alloc_pool, pool_next);
+/*
+ * At least low_water coroutines were not needed during the last interval;
+ * give up half of them, but not more than the pool has grown.
+ */
+static void coroutine_pool_decay(CoroutineThreadPool *tp)
+{
+    unsigned int shrink = MIN(tp->low_water / 2, tp->growth);
+    Coroutine *co;
+
+    tp->growth -= shrink;
+    while (shrink--) {
+        co = QSLIST_FIRST(&tp->alloc_pool);
+        QSLIST_REMOVE_HEAD(&tp->alloc_pool, pool_next);
+        tp->alloc_pool_size--;
         qemu_coroutine_delete(co);
     }
+
+    tp->low_water = tp->alloc_pool_size;
+    tp->creations = 0;
+}
+
+static Coroutine *coroutine_pool_get(void)
+{
+    CoroutineThreadPool *tp = get_ptr_thread_pool();
+    Coroutine *co;
+
+    co = QSLIST_FIRST(&tp->alloc_pool);
+    if (!co) {
+        if (qatomic_read(&release_pool_size) > POOL_MIN_BATCH_SIZE) {
+            /* Slow path; a good place to register the destructor, too.  */
+            coroutine_pool_register_cleanup();
+
+            /* This is not exact; there could be a little skew between
+             * release_pool_size and the actual size of release_pool.  But
+             * it is just a heuristic, it does not need to be perfect.
+             */
+            tp->alloc_pool_size = qatomic_xchg(&release_pool_size, 0);
+            QSLIST_MOVE_ATOMIC(&tp->alloc_pool, &release_pool);
+            co = QSLIST_FIRST(&tp->alloc_pool);
+        }
+    }
+    if (co) {
+        QSLIST_REMOVE_HEAD(&tp->alloc_pool, pool_next);
+        tp->alloc_pool_size--;
+        if (++tp->hits == POOL_MIN_BATCH_SIZE) {
+            stat64_add(&pool_hits, tp->hits);
+            tp->hits = 0;
+        }
+    } else if (tp->growth < POOL_MAX_THREAD_GROWTH) {
+        tp->growth++;
+    }
+
+    tp->low_water = MIN(tp->low_water, tp->alloc_pool_size);
+    if (++tp->creations == POOL_DECAY_INTERVAL) {
+        coroutine_pool_decay(tp);
+    }
+    return co;
 }
 
 Coroutine *qemu_coroutine_create(CoroutineEntry *entry, void *opaque)
@@ -58,34 +157,11 @@ Coroutine *qemu_coroutine_create(CoroutineEntry *entry, void *opaque)
     Coroutine *co = NULL;
 
     if (CONFIG_COROUTINE_POOL) {
-        CoroutineQSList *alloc_pool = get_ptr_alloc_pool();
-
-        co = QSLIST_FIRST(alloc_pool);
-        if (!co) {
-            if (release_pool_size > POOL_MIN_BATCH_SIZE) {
-                /* Slow path; a good place to register the destructor, too.  */
-                Notifier *notifier = get_ptr_coroutine_pool_cleanup_notifier();
-                if (!notifier->notify) {
-                    notifier->notify = coroutine_pool_cleanup;
-                    qemu_thread_atexit_add(notifier);
-                }
-
-                /* This is not exact; there could be a little skew between
-                 * release_pool_size and the actual size of release_pool.  But
-                 * it is just a heuristic, it does not need to be perfect.
-                 */
-                set_alloc_pool_size(qatomic_xchg(&release_pool_size, 0));
-                QSLIST_MOVE_ATOMIC(alloc_pool, &release_pool);
-                co = QSLIST_FIRST(alloc_pool);
-            }
-        }
-        if (co) {
-            QSLIST_REMOVE_HEAD(alloc_pool, pool_next);
-            set_alloc_pool_size(get_alloc_pool_size() - 1);
-        }
+        co = coroutine_pool_get();
     }
 
     if (!co) {
+        stat64_add(&pool_misses, 1);
         co = qemu_coroutine_new();
     }
 
@@ -100,14 +176,18 @@ static void coroutine_delete(Coroutine *co)
     co->caller = NULL;
 
     if (CONFIG_COROUTINE_POOL) {
-        if (release_pool_size < qatomic_read(&pool_max_size) * 2) {
-            QSLIST_INSERT_HEAD_ATOMIC(&release_pool, co, pool_next);
-            qatomic_inc(&release_pool_size);
+        CoroutineThreadPool *tp = get_ptr_thread_pool();
+        unsigned int max_size = qatomic_read(&pool_max_size);
+
+        if (tp->alloc_pool_size < max_size + tp->growth) {
+            coroutine_pool_register_cleanup();
+            QSLIST_INSERT_HEAD(&tp->alloc_pool, co, pool_next);
+            tp->alloc_pool_size++;
             return;
         }
-        if (get_alloc_pool_size() < qatomic_read(&pool_max_size)) {
-            QSLIST_INSERT_HEAD(get_ptr_alloc_pool(), co, pool_next);
-            set_alloc_pool_size(get_alloc_pool_size() + 1);
+        if (qatomic_read(&release_pool_size) < max_size * 2) {
+            QSLIST_INSERT_HEAD_ATOMIC(&release_pool, co, pool_next);
+            qatomic_inc(&release_pool_size);
             return;
         }
     }
@@ -226,3 +306,9 @@ void qemu_coroutine_dec_pool_size(unsigned int removing_pool_size)
 {
     qatomic_sub(&pool_max_size, removing_pool_size);
 }
+
+void qemu_coroutine_get_pool_stats(uint64_t *hits, uint64_t *misses)
+{
+    *hits = stat64_get(&pool_hits);
+    *misses = stat64_get(&pool_misses);
+}
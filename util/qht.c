@@ -24,6 +24,9 @@
  * - Optional auto-resizing: the hash table resizes up if the load surpasses
  *   a certain threshold. Resizing is done concurrently with readers; writes
  *   are serialized with the resize operation.
+ * - Optional partitioning: the hash table is split into parts, each with its
+ *   own map and lock.  Lookups need no more than one extra load, while
+ *   resizes and the cacheline traffic they cause are limited to one part.
  *
  * The key structure is the bucket, which is cacheline-sized. Buckets
  * contain a few hash values and pointers; the u32 hash values are stored in
@@ -194,6 +197,20 @@ struct qht_map {
 /* trigger a resize when n_added_buckets > n_buckets / div */
 #define QHT_NR_ADDED_BUCKETS_THRESHOLD_DIV 8
 
+/*
+ * Number of parts of a QHT_MODE_PARTITIONED hash table.  The part is chosen
+ * from a multiplicative hash of the entry's hash, so that it does not
+ * correlate with the bucket index, which uses the low bits of the hash.
+ */
+#define QHT_PARTITION_BITS 4
+#define QHT_PARTITIONS (1 << QHT_PARTITION_BITS)
+#define QHT_PARTITION_MULT 0x9e3779b1u
+
+/* keep the parts' map pointers, read by every lookup, in separate lines */
+struct qht_part {
+    struct qht ht;
+} QEMU_ALIGNED(QHT_BUCKET_ALIGN);
+
 static void qht_do_resize_reset(struct qht *ht, struct qht_map *new,
                                 bool reset);
 static void qht_grow_maybe(struct qht *ht);
@@ -249,6 +266,18 @@ static inline size_t qht_elems_to_buckets(size_t n_elems)
     return pow2ceil(n_elems / QHT_BUCKET_ENTRIES);
 }
 
+static inline struct qht *qht_part(const struct qht *ht, uint32_t hash)
+{
+    uint32_t i = (hash * QHT_PARTITION_MULT) >> (32 - QHT_PARTITION_BITS);
+
+    return &ht->parts[i].ht;
+}
+
+static inline size_t qht_part_elems(size_t n_elems)
+{
+    return DIV_ROUND_UP(n_elems, QHT_PARTITIONS);
+}
+
 /*
  * When using striped locks (i.e. under TSAN), we have to be careful not
  * to operate on the same lock twice (e.g. when iterating through all buckets).
@@ -472,6 +501,21 @@ void qht_init(struct qht *ht, qht_cmp_func_t cmp, size_t n_elems,
     ht->cmp = cmp;
     ht->mode = mode;
     qemu_mutex_init(&ht->lock);
+
+    if (mode & QHT_MODE_PARTITIONED) {
+        int i;
+
+        ht->map = NULL;
+        ht->parts = qemu_memalign(QHT_BUCKET_ALIGN,
+                                  sizeof(*ht->parts) * QHT_PARTITIONS);
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            qht_init(&ht->parts[i].ht, cmp, qht_part_elems(n_elems),
+                     mode & ~QHT_MODE_PARTITIONED);
+        }
+        return;
+    }
+
+    ht->parts = NULL;
     map = qht_map_create(n_buckets);
     qatomic_rcu_set(&ht->map, map);
 }
@@ -479,7 +523,16 @@ void qht_init(struct qht *ht, qht_cmp_func_t cmp, size_t n_elems,
 /* call only when there are no readers/writers left */
 void qht_destroy(struct qht *ht)
 {
-    qht_map_destroy(ht->map);
+    if (ht->parts) {
+        int i;
+
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            qht_destroy(&ht->parts[i].ht);
+        }
+        qemu_vfree(ht->parts);
+    } else {
+        qht_map_destroy(ht->map);
+    }
     memset(ht, 0, sizeof(*ht));
 }
 
@@ -518,6 +571,15 @@ void qht_reset(struct qht *ht)
 {
     struct qht_map *map;
 
+    if (ht->parts) {
+        int i;
+
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            qht_reset(&ht->parts[i].ht);
+        }
+        return;
+    }
+
     qht_map_lock_buckets__no_stale(ht, &map);
     qht_map_reset__all_locked(map);
     qht_map_unlock_buckets(map);
@@ -539,6 +601,16 @@ bool qht_reset_size(struct qht *ht, size_t n_elems)
     struct qht_map *map;
     size_t n_buckets;
 
+    if (ht->parts) {
+        bool ret = false;
+        int i;
+
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            ret |= qht_reset_size(&ht->parts[i].ht, qht_part_elems(n_elems));
+        }
+        return ret;
+    }
+
     n_buckets = qht_elems_to_buckets(n_elems);
 
     qht_lock(ht);
@@ -601,6 +673,9 @@ void *qht_lookup_custom(const struct qht *ht, const void *userp, uint32_t hash,
     unsigned int version;
     void *ret;
 
+    if (ht->parts) {
+        ht = qht_part(ht, hash);
+    }
     map = qatomic_rcu_read(&ht->map);
     b = qht_map_to_bucket(map, hash);
 
@@ -702,6 +777,9 @@ bool qht_insert(struct qht *ht, void *p, uint32_t hash, void **existing)
     /* NULL pointers are not supported */
     qht_debug_assert(p);
 
+    if (ht->parts) {
+        ht = qht_part(ht, hash);
+    }
     b = qht_bucket_lock__no_stale(ht, hash, &map);
     prev = qht_insert__locked(ht, map, b, p, hash, &needs_resize);
     qht_bucket_debug__locked(b);
@@ -813,6 +891,9 @@ bool qht_remove(struct qht *ht, const void *p, uint32_t hash)
     /* NULL pointers are not supported */
     qht_debug_assert(p);
 
+    if (ht->parts) {
+        ht = qht_part(ht, hash);
+    }
     b = qht_bucket_lock__no_stale(ht, hash, &map);
     ret = qht_remove__locked(b, p, hash);
     qht_bucket_debug__locked(b);
@@ -872,6 +953,15 @@ do_qht_iter(struct qht *ht, const struct qht_iter *iter, void *userp)
 {
     struct qht_map *map;
 
+    if (ht->parts) {
+        int i;
+
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            do_qht_iter(&ht->parts[i].ht, iter, userp);
+        }
+        return;
+    }
+
     map = qatomic_rcu_read(&ht->map);
     qht_map_lock_buckets(map);
     qht_map_iter__all_locked(map, iter, userp);
@@ -955,6 +1045,15 @@ bool qht_resize(struct qht *ht, size_t n_elems)
     size_t n_buckets = qht_elems_to_buckets(n_elems);
     size_t ret = false;
 
+    if (ht->parts) {
+        int i;
+
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            ret |= qht_resize(&ht->parts[i].ht, qht_part_elems(n_elems));
+        }
+        return ret;
+    }
+
     qht_lock(ht);
     if (n_buckets != ht->map->n_buckets) {
         struct qht_map *new;
@@ -968,24 +1067,12 @@ bool qht_resize(struct qht *ht, size_t n_elems)
     return ret;
 }
 
-/* pass @stats to qht_statistics_destroy() when done */
-void qht_statistics_init(const struct qht *ht, struct qht_stats *stats)
+static void qht_map_statistics(const struct qht_map *map,
+                               struct qht_stats *stats)
 {
-    const struct qht_map *map;
     int i;
 
-    map = qatomic_rcu_read(&ht->map);
-
-    stats->used_head_buckets = 0;
-    stats->entries = 0;
-    qdist_init(&stats->chain);
-    qdist_init(&stats->occupancy);
-    /* bail out if the qht has not yet been initialized */
-    if (unlikely(map == NULL)) {
-        stats->head_buckets = 0;
-        return;
-    }
-    stats->head_buckets = map->n_buckets;
+    stats->head_buckets += map->n_buckets;
 
     for (i = 0; i < map->n_buckets; i++) {
         const struct qht_bucket *head = &map->buckets[i];
@@ -1024,6 +1111,34 @@ void qht_statistics_init(const struct qht *ht, struct qht_stats *stats)
     }
 }
 
+/* pass @stats to qht_statistics_destroy() when done */
+void qht_statistics_init(const struct qht *ht, struct qht_stats *stats)
+{
+    const struct qht_map *map;
+    int i;
+
+    stats->head_buckets = 0;
+    stats->used_head_buckets = 0;
+    stats->entries = 0;
+    qdist_init(&stats->chain);
+    qdist_init(&stats->occupancy);
+
+    if (ht->parts) {
+        for (i = 0; i < QHT_PARTITIONS; i++) {
+            map = qatomic_rcu_read(&ht->parts[i].ht.map);
+            qht_map_statistics(map, stats);
+        }
+        return;
+    }
+
+    map = qatomic_rcu_read(&ht->map);
+    /* bail out if the qht has not yet been initialized */
+    if (unlikely(map == NULL)) {
+        return;
+    }
+    qht_map_statistics(map, stats);
+}
+
 void qht_statistics_destroy(struct qht_stats *stats)
 {
     qdist_destroy(&stats->occupancy);
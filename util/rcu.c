@@ -32,6 +32,9 @@
 #include "qemu/thread.h"
 #include "qemu/main-loop.h"
 #include "qemu/lockable.h"
+#include "qemu/stats64.h"
+#include "qemu/host-utils.h"
+#include "qemu/timer.h"
 #if defined(CONFIG_MALLOC_TRIM)
 #include <malloc.h>
 #endif
@@ -47,6 +50,7 @@ unsigned long rcu_gp_ctr = RCU_GP_LOCKED;
 
 QemuEvent rcu_gp_event;
 static int in_drain_call_rcu;
+static bool rcu_expedited;
 static QemuMutex rcu_registry_lock;
 static QemuMutex rcu_sync_lock;
 
@@ -71,6 +75,13 @@ QEMU_DEFINE_CO_TLS(struct rcu_reader_data, rcu_reader)
 typedef QLIST_HEAD(, rcu_reader_data) ThreadList;
 static ThreadList registry = QLIST_HEAD_INITIALIZER(registry);
 
+/* See rcu_get_stats().  */
+static Stat64 rcu_grace_periods;
+static Stat64 rcu_expedited_grace_periods;
+static Stat64 rcu_callbacks;
+static Stat64 rcu_max_batch;
+static Stat64 rcu_gp_latency[RCU_GP_LATENCY_BUCKETS];
+
 /* Wait for previous parity/grace period to be empty of readers.  */
 static void wait_for_readers(void)
 {
@@ -108,7 +119,8 @@ static void wait_for_readers(void)
                  * get some extra futex wakeups.
                  */
                 qatomic_set(&index->waiting, false);
-            } else if (qatomic_read(&in_drain_call_rcu)) {
+            } else if (qatomic_read(&in_drain_call_rcu) ||
+                       qatomic_read(&rcu_expedited)) {
                 notifier_list_notify(&index->force_rcu, NULL);
             }
         }
@@ -143,7 +155,7 @@ static void wait_for_readers(void)
     QLIST_SWAP(&registry, &qsreaders, node);
 }
 
-void synchronize_rcu(void)
+static void do_synchronize_rcu(void)
 {
     QEMU_LOCK_GUARD(&rcu_sync_lock);
 
@@ -175,6 +187,20 @@ void synchronize_rcu(void)
     }
 }
 
+void synchronize_rcu(void)
+{
+    int64_t start = get_clock();
+    int64_t ns;
+    int bucket;
+
+    do_synchronize_rcu();
+
+    ns = get_clock() - start;
+    bucket = ns > 0 ? 63 - clz64(ns) : 0;
+    stat64_add(&rcu_gp_latency[MIN(bucket, RCU_GP_LATENCY_BUCKETS - 1)], 1);
+    stat64_add(&rcu_grace_periods, 1);
+}
+
 
 #define RCU_CALL_MIN_SIZE        30
 
@@ -244,12 +270,16 @@ static void *call_rcu_thread(void *opaque)
     for (;;) {
         int tries = 0;
         int n = qatomic_read(&rcu_call_count);
+        bool expedite;
 
-        /* Heuristically wait for a decent number of callbacks to pile up.
+        /* Heuristically wait for a decent number of callbacks to pile up,
+         * unless somebody is waiting in drain_call_rcu().
          * Fetch rcu_call_count now, we only must process elements that were
          * added before synchronize_rcu() starts.
          */
-        while (n == 0 || (n < RCU_CALL_MIN_SIZE && ++tries <= 5)) {
+        while (n == 0 ||
+               (n < RCU_CALL_MIN_SIZE && !qatomic_read(&in_drain_call_rcu) &&
+                ++tries <= 5)) {
             g_usleep(10000);
             if (n == 0) {
                 qemu_event_reset(&rcu_call_ready_event);
@@ -264,8 +294,17 @@ static void *call_rcu_thread(void *opaque)
             n = qatomic_read(&rcu_call_count);
         }
 
+        stat64_max(&rcu_max_batch, n);
+        stat64_add(&rcu_callbacks, n);
+        expedite = n >= RCU_CALL_EXPEDITE_SIZE;
+        if (expedite) {
+            qatomic_set(&rcu_expedited, true);
+            stat64_add(&rcu_expedited_grace_periods, 1);
+        }
+
         qatomic_sub(&rcu_call_count, n);
         synchronize_rcu();
+        qatomic_set(&rcu_expedited, false);
         qemu_mutex_lock_iothread();
         while (n > 0) {
             node = try_dequeue();
@@ -368,6 +407,20 @@ void rcu_unregister_thread(void)
     qemu_mutex_unlock(&rcu_registry_lock);
 }
 
+void rcu_get_stats(RCUStats *stats)
+{
+    int i;
+
+    stats->grace_periods = stat64_get(&rcu_grace_periods);
+    stats->expedited_grace_periods = stat64_get(&rcu_expedited_grace_periods);
+    stats->callbacks = stat64_get(&rcu_callbacks);
+    stats->backlog = MAX(qatomic_read(&rcu_call_count), 0);
+    stats->max_batch = stat64_get(&rcu_max_batch);
+    for (i = 0; i < RCU_GP_LATENCY_BUCKETS; i++) {
+        stats->gp_latency[i] = stat64_get(&rcu_gp_latency[i]);
+    }
+}
+
 void rcu_add_force_rcu_notifier(Notifier *n)
 {
     qemu_mutex_lock(&rcu_registry_lock);
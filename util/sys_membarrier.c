@@ -8,12 +8,24 @@
 
 #include "qemu/osdep.h"
 #include "qemu/sys_membarrier.h"
+#include "qemu/atomic.h"
 #include "qemu/error-report.h"
 
 #ifdef CONFIG_LINUX
 #include <linux/membarrier.h>
 #include <sys/syscall.h>
 
+/* Older <linux/membarrier.h> lack these (Linux 4.14) */
+#define QEMU_MEMBARRIER_CMD_PRIVATE_EXPEDITED           (1 << 3)
+#define QEMU_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED  (1 << 4)
+
+/*
+ * MEMBARRIER_CMD_SHARED waits for a scheduler grace period, which can take
+ * milliseconds.  The private expedited command interrupts the CPUs that run
+ * our threads instead, and returns in microseconds.
+ */
+static int membarrier_cmd = MEMBARRIER_CMD_SHARED;
+
 static int
 membarrier(int cmd, int flags)
 {
@@ -26,7 +38,13 @@ void smp_mb_global(void)
 #if defined CONFIG_WIN32
     FlushProcessWriteBuffers();
 #elif defined CONFIG_LINUX
-    membarrier(MEMBARRIER_CMD_SHARED, 0);
+    int cmd = qatomic_read(&membarrier_cmd);
+
+    if (membarrier(cmd, 0) < 0 && cmd != MEMBARRIER_CMD_SHARED) {
+        /* e.g. a child process that has not registered itself */
+        qatomic_set(&membarrier_cmd, MEMBARRIER_CMD_SHARED);
+        membarrier(MEMBARRIER_CMD_SHARED, 0);
+    }
 #else
 #error --enable-membarrier is not supported on this operating system.
 #endif
@@ -46,5 +64,9 @@ void smp_mb_global_init(void)
         error_report("Please upgrade your system to a newer version of Linux");
         exit(1);
     }
+    if ((ret & QEMU_MEMBARRIER_CMD_PRIVATE_EXPEDITED) &&
+        membarrier(QEMU_MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0) == 0) {
+        membarrier_cmd = QEMU_MEMBARRIER_CMD_PRIVATE_EXPEDITED;
+    }
 #endif
 }
@@ -39,8 +39,9 @@ struct ThreadPoolElement {
     void *arg;
 
     /* Moving state out of THREAD_QUEUED is protected by lock.  After
-     * that, only the worker thread can write to it.  Reads and writes
-     * of state and ret are ordered with memory barriers.
+     * that, only the worker thread can write to it.  The element is
+     * published to the completion bottom half by an atomic insertion in
+     * the completed list, which orders the writes to state and ret.
      */
     enum ThreadState state;
     int ret;
@@ -48,6 +49,9 @@ struct ThreadPoolElement {
     /* Access to this list is protected by lock.  */
     QTAILQ_ENTRY(ThreadPoolElement) reqs;
 
+    /* Entry in the completed or done_list lists of the pool.  */
+    QSLIST_ENTRY(ThreadPoolElement) done;
+
     /* Access to this list is protected by the global mutex.  */
     QLIST_ENTRY(ThreadPoolElement) all;
 };
@@ -62,6 +66,13 @@ struct ThreadPool {
 
     /* The following variables are only accessed from one AioContext. */
     QLIST_HEAD(, ThreadPoolElement) head;
+    QSLIST_HEAD(, ThreadPoolElement) done_list;
+
+    /*
+     * Requests that have finished running, pushed atomically by the
+     * workers and moved in batches to done_list by the completion BH.
+     */
+    QSLIST_HEAD(, ThreadPoolElement) completed;
 
     /* The following variables are protected by lock.  */
     QTAILQ_HEAD(, ThreadPoolElement) request_list;
@@ -110,10 +121,14 @@ static void *worker_thread(void *opaque)
         ret = req->func(req->arg);
 
         req->ret = ret;
-        /* Write ret before state.  */
-        smp_wmb();
         req->state = THREAD_DONE;
 
+        /*
+         * Publish ret and state; req may be freed as soon as it is in the
+         * list.  Synchronizes with QSLIST_MOVE_ATOMIC in
+         * thread_pool_completion_bh.
+         */
+        QSLIST_INSERT_HEAD_ATOMIC(&pool->completed, req, done);
         qemu_bh_schedule(pool->completion_bh);
         qemu_mutex_lock(&pool->lock);
     }
@@ -170,26 +185,57 @@ static void spawn_thread(ThreadPool *pool)
     }
 }
 
+/*
+ * Move the requests completed so far to done_list, in the order they
+ * completed.  Only called when done_list is empty.
+ */
+static void thread_pool_collect_completed(ThreadPool *pool)
+{
+    QSLIST_HEAD(, ThreadPoolElement) batch;
+    ThreadPoolElement *elem;
+
+    /* Synchronizes with QSLIST_INSERT_HEAD_ATOMIC in worker_thread.  */
+    QSLIST_MOVE_ATOMIC(&batch, &pool->completed);
+
+    /*
+     * The batch is most recently completed first; reversing it restores
+     * completion order.  Requests can complete in any order, so this is
+     * not necessarily the order they were submitted in.
+     */
+    while ((elem = QSLIST_FIRST(&batch)) != NULL) {
+        QSLIST_REMOVE_HEAD(&batch, done);
+        QSLIST_INSERT_HEAD(&pool->done_list, elem, done);
+    }
+}
+
 static void thread_pool_completion_bh(void *opaque)
 {
     ThreadPool *pool = opaque;
-    ThreadPoolElement *elem, *next;
+    ThreadPoolElement *elem;
 
     aio_context_acquire(pool->ctx);
-restart:
-    QLIST_FOREACH_SAFE(elem, &pool->head, all, next) {
-        if (elem->state != THREAD_DONE) {
-            continue;
+    for (;;) {
+        if (QSLIST_EMPTY(&pool->done_list)) {
+            thread_pool_collect_completed(pool);
+            if (QSLIST_EMPTY(&pool->done_list)) {
+                break;
+            }
         }
 
+        /*
+         * done_list lives in the pool rather than on the stack, so that a
+         * nested invocation from aio_poll() in a callback picks up where
+         * we left off.
+         */
+        elem = QSLIST_FIRST(&pool->done_list);
+        QSLIST_REMOVE_HEAD(&pool->done_list, done);
+        assert(elem->state == THREAD_DONE);
+
         trace_thread_pool_complete(pool, elem, elem->common.opaque,
                                    elem->ret);
         QLIST_REMOVE(elem, all);
 
         if (elem->common.cb) {
-            /* Read state before ret.  */
-            smp_rmb();
-
             /* Schedule ourselves in case elem->common.cb() calls aio_poll() to
              * wait for another request that completed at the same time.
              */
@@ -200,16 +246,12 @@ restart:
             aio_context_acquire(pool->ctx);
 
             /* We can safely cancel the completion_bh here regardless of someone
-             * else having scheduled it meanwhile because we reenter the
-             * completion function anyway (goto restart).
+             * else having scheduled it meanwhile because the loop collects
+             * newly completed requests before it terminates.
              */
             qemu_bh_cancel(pool->completion_bh);
-
-            qemu_aio_unref(elem);
-            goto restart;
-        } else {
-            qemu_aio_unref(elem);
         }
+        qemu_aio_unref(elem);
     }
     aio_context_release(pool->ctx);
 }
@@ -224,10 +266,11 @@ static void thread_pool_cancel(BlockAIOCB *acb)
     QEMU_LOCK_GUARD(&pool->lock);
     if (elem->state == THREAD_QUEUED) {
         QTAILQ_REMOVE(&pool->request_list, elem, reqs);
-        qemu_bh_schedule(pool->completion_bh);
 
         elem->state = THREAD_DONE;
         elem->ret = -ECANCELED;
+        QSLIST_INSERT_HEAD_ATOMIC(&pool->completed, elem, done);
+        qemu_bh_schedule(pool->completion_bh);
     }
 
 }
@@ -250,6 +293,7 @@ BlockAIOCB *thread_pool_submit_aio(ThreadPool *pool,
         BlockCompletionFunc *cb, void *opaque)
 {
     ThreadPoolElement *req;
+    bool wake;
 
     req = qemu_aio_get(&thread_pool_aiocb_info, NULL, cb, opaque);
     req->func = func;
@@ -266,8 +310,15 @@ BlockAIOCB *thread_pool_submit_aio(ThreadPool *pool,
         spawn_thread(pool);
     }
     QTAILQ_INSERT_TAIL(&pool->request_list, req, reqs);
+    /*
+     * Busy workers check request_list under the lock before they go idle,
+     * so only waiting ones need a (costly) wakeup.
+     */
+    wake = pool->idle_threads > 0;
     qemu_mutex_unlock(&pool->lock);
-    qemu_cond_signal(&pool->request_cond);
+    if (wake) {
+        qemu_cond_signal(&pool->request_cond);
+    }
     return &req->common;
 }
 
@@ -341,6 +392,8 @@ static void thread_pool_init_one(ThreadPool *pool, AioContext *ctx)
     pool->new_thread_bh = aio_bh_new(ctx, spawn_thread_bh_fn, pool);
 
     QLIST_INIT(&pool->head);
+    QSLIST_INIT(&pool->done_list);
+    QSLIST_INIT(&pool->completed);
     QTAILQ_INIT(&pool->request_list);
 
     thread_pool_update_params(pool, ctx);